@@ -15,6 +15,7 @@
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
 #include <barretenberg/dsl/acir_proofs/goblin_acir_composer.hpp>
+#include <barretenberg/srs/factories/file_crs_factory.hpp>
 #include <barretenberg/srs/global_crs.hpp>
 #include <cstdint>
 #include <iostream>
@@ -32,6 +33,8 @@ std::string getHomeDir()
 
 std::string CRS_PATH = getHomeDir() + "/.bb-crs";
 bool verbose = false;
+// Set with --key-cache <dir>: proving and verification keys are cached there, keyed by circuit hash
+std::shared_ptr<plonk::ProvingKeyCache> key_cache;
 
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
@@ -44,6 +47,11 @@ const auto current_dir = current_path.filename().string();
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
+    if (srs::factories::get_native_crs_size<curve::BN254>(CRS_PATH) >= dyadic_circuit_size + 1) {
+        vinfo("using native crs at: ", srs::factories::get_native_crs_path(CRS_PATH));
+        srs::init_crs_factory(CRS_PATH);
+        return;
+    }
     auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
     srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
@@ -57,6 +65,12 @@ void init_bn254_crs(size_t dyadic_circuit_size)
  */
 void init_grumpkin_crs(size_t eccvm_dyadic_circuit_size)
 {
+    const std::string native_crs_path = CRS_PATH + "/grumpkin";
+    if (srs::factories::get_native_crs_size<curve::Grumpkin>(native_crs_path) >= eccvm_dyadic_circuit_size) {
+        vinfo("using native crs at: ", srs::factories::get_native_crs_path(native_crs_path));
+        srs::init_grumpkin_crs_factory(native_crs_path);
+        return;
+    }
     auto grumpkin_g1_data = get_grumpkin_g1_data(CRS_PATH, eccvm_dyadic_circuit_size);
     srs::init_grumpkin_crs_factory(grumpkin_g1_data);
 }
@@ -102,6 +116,7 @@ bool proveAndVerify(const std::string& bytecodePath, const std::string& witnessP
     auto witness = get_witness(witnessPath);
 
     acir_proofs::AcirComposer acir_composer{ 0, verbose };
+    acir_composer.set_key_cache(key_cache);
     acir_composer.create_circuit(constraint_system, witness);
 
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
@@ -121,6 +136,11 @@ bool proveAndVerify(const std::string& bytecodePath, const std::string& witnessP
     acir_composer.init_verification_key();
     write_benchmark("vk_construction_time", vk_timer.milliseconds(), "acir_test", current_dir);
 
+    if (key_cache) {
+        write_benchmark("key_cache_hits", key_cache->get_num_hits(), "acir_test", current_dir);
+        write_benchmark("key_cache_misses", key_cache->get_num_misses(), "acir_test", current_dir);
+    }
+
     auto verified = acir_composer.verify_proof(proof);
 
     vinfo("verified: ", verified);
@@ -221,6 +241,7 @@ void prove(const std::string& bytecodePath, const std::string& witnessPath, cons
     auto witness = get_witness(witnessPath);
 
     acir_proofs::AcirComposer acir_composer{ 0, verbose };
+    acir_composer.set_key_cache(key_cache);
     acir_composer.create_circuit(constraint_system, witness);
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
     acir_composer.init_proving_key();
@@ -295,6 +316,7 @@ void write_vk(const std::string& bytecodePath, const std::string& outputPath)
 {
     auto constraint_system = get_constraint_system(bytecodePath);
     acir_proofs::AcirComposer acir_composer{ 0, verbose };
+    acir_composer.set_key_cache(key_cache);
     acir_composer.create_circuit(constraint_system);
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
     acir_composer.init_proving_key();
@@ -313,6 +335,7 @@ void write_pk(const std::string& bytecodePath, const std::string& outputPath)
 {
     auto constraint_system = get_constraint_system(bytecodePath);
     acir_proofs::AcirComposer acir_composer{ 0, verbose };
+    acir_composer.set_key_cache(key_cache);
     acir_composer.create_circuit(constraint_system);
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
     auto pk = acir_composer.init_proving_key();
@@ -525,6 +548,61 @@ bool avm_verify(const std::filesystem::path& proof_path)
     return true;
 }
 
+/**
+ * @brief Converts a CRS into the native format that later invocations memory map instead of parsing, see
+ * srs::factories::get_native_crs_path
+ *
+ * Communication:
+ * - Filesystem: The native CRS is written to CRS_PATH/monomial (CRS_PATH/grumpkin/monomial for grumpkin), or next
+ *   to the transcripts if transcript_dir is given
+ *
+ * @param num_points The number of points to convert. 0 converts every point in the transcripts, or everything cached
+ * in CRS_PATH
+ * @param transcript_dir A directory of ignition style transcript files (e.g. srs_db/ignition) to convert in place. If
+ * empty the CRS cached in CRS_PATH is converted, downloading it first if it has fewer than num_points points
+ * @param grumpkin Convert the grumpkin CRS instead of the bn254 one
+ */
+void convert_crs(size_t num_points, const std::string& transcript_dir, bool grumpkin)
+{
+    if (!transcript_dir.empty()) {
+        if (grumpkin) {
+            srs::factories::convert_transcript_to_native_crs<curve::Grumpkin>(transcript_dir, num_points);
+        } else {
+            srs::factories::convert_transcript_to_native_crs<curve::BN254>(transcript_dir, num_points);
+        }
+        vinfo("native crs written to: ", srs::factories::get_native_crs_path(transcript_dir));
+        return;
+    }
+
+    if (grumpkin) {
+        if (num_points == 0) {
+            std::ifstream size_file(CRS_PATH + "/grumpkin_size");
+            size_file >> num_points;
+        }
+        if (num_points == 0) {
+            throw std::runtime_error("No grumpkin crs cached, specify the number of points with -n.");
+        }
+        const std::string native_crs_path = CRS_PATH + "/grumpkin";
+        auto grumpkin_g1_data = get_grumpkin_g1_data(CRS_PATH, num_points);
+        std::filesystem::create_directories(native_crs_path + "/monomial");
+        srs::factories::write_native_crs(native_crs_path, grumpkin_g1_data);
+        vinfo("native crs written to: ", srs::factories::get_native_crs_path(native_crs_path));
+        return;
+    }
+
+    if (num_points == 0) {
+        num_points = get_file_size(CRS_PATH + "/bn254_g1.dat") / 64;
+    }
+    if (num_points == 0) {
+        throw std::runtime_error("No bn254 crs cached, specify the number of points with -n.");
+    }
+    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, num_points);
+    auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
+    std::filesystem::create_directories(CRS_PATH + "/monomial");
+    srs::factories::write_native_crs(CRS_PATH, bn254_g1_data, bn254_g2_data);
+    vinfo("native crs written to: ", srs::factories::get_native_crs_path(CRS_PATH));
+}
+
 bool flag_present(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -555,6 +633,10 @@ int main(int argc, char* argv[])
         std::string vk_path = get_option(args, "-k", "./target/vk");
         std::string pk_path = get_option(args, "-r", "./target/pk");
         CRS_PATH = get_option(args, "-c", CRS_PATH);
+        if (std::string key_cache_path = get_option(args, "--key-cache", ""); !key_cache_path.empty()) {
+            std::filesystem::create_directories(key_cache_path);
+            key_cache = std::make_shared<plonk::ProvingKeyCache>(key_cache_path);
+        }
 
         // Skip CRS initialization for any command which doesn't require the CRS.
         if (command == "--version") {
@@ -566,6 +648,11 @@ int main(int argc, char* argv[])
             acvm_info(output_path);
             return 0;
         }
+        if (command == "convert_crs") {
+            const size_t num_points = std::stoul(get_option(args, "-n", "0"));
+            convert_crs(num_points, get_option(args, "-t", ""), flag_present(args, "--grumpkin"));
+            return 0;
+        }
         if (command == "prove_and_verify") {
             return proveAndVerify(bytecode_path, witness_path) ? 0 : 1;
         }
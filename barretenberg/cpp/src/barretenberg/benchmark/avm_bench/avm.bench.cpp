@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/sumcheck/sumcheck.hpp"
+#include "barretenberg/vm/avm_trace/avm_trace.hpp"
+#include "barretenberg/vm/generated/avm_composer.hpp"
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::avm_trace;
+
+using Flavor = AvmFlavor;
+using FF = Flavor::FF;
+using Builder = AvmCircuitBuilder;
+using Composer = AvmComposer;
+
+namespace {
+
+/**
+ * @brief A synthetic trace of num_rows rows, obtained by repeating the trace of a program of field arithmetic
+ * @details The trace builder is limited to AVM_TRACE_SIZE rows, so the trace of a single program is repeated to reach
+ * the target size. The repeated trace does not satisfy the relations, but has the selector density of a real one.
+ */
+Builder generate_trace(size_t num_rows)
+{
+    AvmTraceBuilder trace_builder;
+    trace_builder.calldata_copy(0, 0, 4, 0, std::vector<FF>{ 37, 4, 11, 5 });
+    for (uint32_t i = 0; i < 16; i++) {
+        trace_builder.op_add(0, i % 4, (i + 1) % 4, 4 + (i % 4), AvmMemoryTag::FF);
+        trace_builder.op_mul(0, 4 + (i % 4), (i + 2) % 4, i % 4, AvmMemoryTag::FF);
+        trace_builder.op_sub(0, i % 4, 4 + ((i + 3) % 4), (i + 1) % 4, AvmMemoryTag::FF);
+    }
+    trace_builder.return_op(0, 0, 4);
+    const auto program_trace = trace_builder.finalize();
+
+    std::vector<Builder::Row> trace;
+    trace.reserve(num_rows);
+    while (trace.size() < num_rows) {
+        trace.push_back(program_trace[trace.size() % program_trace.size()]);
+    }
+    Builder builder;
+    builder.set_trace(std::move(trace));
+    return builder;
+}
+
+void avm_prove(State& state) noexcept
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    Builder builder = generate_trace(1 << static_cast<size_t>(state.range(0)));
+    Composer composer;
+    auto prover = composer.create_prover(builder);
+    for (auto _ : state) {
+        auto proof = prover.construct_proof();
+    };
+}
+
+/**
+ * @brief The sumcheck of the AVM, with the work of each round split by edges (range(1) = 0) or by relation and edges
+ * (range(1) = 1), see SumcheckProverRound::schedule_by_relation
+ */
+void avm_sumcheck(State& state) noexcept
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    Builder builder = generate_trace(1 << static_cast<size_t>(state.range(0)));
+    Composer composer;
+    auto prover = composer.create_prover(builder);
+    const size_t circuit_size = prover.key->circuit_size;
+
+    const auto relation_parameters = RelationParameters<FF>::get_random();
+    const FF alpha = FF::random_element();
+    std::vector<FF> gate_challenges(numeric::get_msb(circuit_size));
+    for (auto& gate_challenge : gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+    for (auto _ : state) {
+        auto sumcheck = SumcheckProver<Flavor>(circuit_size, std::make_shared<Flavor::Transcript>());
+        sumcheck.round.schedule_by_relation = state.range(1) != 0;
+        auto output = sumcheck.prove(prover.prover_polynomials, relation_parameters, alpha, gate_challenges);
+        DoNotOptimize(output);
+    };
+}
+
+BENCHMARK(avm_prove)->Unit(kMillisecond)->DenseRange(14, 18);
+BENCHMARK(avm_sumcheck)->Unit(kMillisecond)->ArgsProduct({ benchmark::CreateDenseRange(14, 18, 1), { 0, 1 } });
+} // namespace
+
+BENCHMARK_MAIN();
@@ -8,6 +8,8 @@
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
 
+#include <deque>
+
 using namespace benchmark;
 using namespace bb;
 
@@ -242,6 +244,44 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Translator)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Benchmark the accumulation of a number of function circuits, either synchronously or asynchronously, in which
+ * case each circuit is constructed while the previous ones are being folded
+ *
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, AccumulateFunctionCircuits)(benchmark::State& state)
+{
+    const auto num_circuits = static_cast<size_t>(state.range(0));
+    const bool is_async = state.range(1) != 0;
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        ClientIVC ivc;
+        Builder initial_circuit{ ivc.goblin.op_queue };
+        GoblinMockCircuits::construct_mock_function_circuit(initial_circuit);
+        ivc.initialize(initial_circuit);
+
+        // The circuits must outlive the construction of their instances, which is complete for all but the ones
+        // still in flight
+        std::deque<Builder> circuits;
+        for (size_t circuit_idx = 0; circuit_idx < num_circuits; ++circuit_idx) {
+            Builder& circuit = circuits.emplace_back(ivc.goblin.op_queue);
+            {
+                BB_OP_COUNT_TIME_NAME("construct_circuits");
+                GoblinMockCircuits::construct_mock_function_circuit(circuit);
+            }
+            if (is_async) {
+                ivc.accumulate_async(circuit);
+            } else {
+                ivc.accumulate(circuit);
+            }
+            while (circuits.size() > ivc.max_in_flight_instances) {
+                circuits.pop_front();
+            }
+        }
+        ivc.wait_for_in_flight_folds();
+    }
+}
+
 #define ARGS                                                                                                           \
     Arg(ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY)                                                              \
         ->Arg(1 << 1)                                                                                                  \
@@ -256,6 +296,10 @@ BENCHMARK_REGISTER_F(ClientIVCBench, Accumulate)->Unit(benchmark::kMillisecond)-
 BENCHMARK_REGISTER_F(ClientIVCBench, Decide)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, ECCVM)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Translator)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, AccumulateFunctionCircuits)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 2, 4, 8 }, { 0, 1 } })
+    ->UseRealTime();
 
 } // namespace
 
@@ -0,0 +1,179 @@
+/**
+ * @file parallel_for.bench.cpp
+ * @brief Compares the pluggable parallel_for backends (see common/thread.cpp) on synthetic workloads
+ * @details
+ *  - startup: one iteration per cpu with almost no work, i.e. the cost of waking the pool and joining.
+ *  - uniform: many iterations of equal cost, the common "parallel_for(num_points)" pattern.
+ *  - skewed: iteration cost grows linearly with the index, stressing load balancing.
+ *  - nested: an outer loop whose iterations run inner loops (e.g. sumcheck calling into a parallel MSM). Only the
+ *    work stealing pool supports this, the others are run with the inner loop flattened into the outer one.
+ *  - reduce: summing field elements, with a shared accumulator under a mutex vs parallel_reduce's padded slots.
+ */
+#include "barretenberg/common/task_graph.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <benchmark/benchmark.h>
+#include <mutex>
+
+using namespace benchmark;
+
+namespace bb {
+void parallel_for_moody(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+} // namespace bb
+
+namespace {
+using ParallelFor = void (*)(size_t, const std::function<void(size_t)>&);
+
+constexpr size_t NESTED_OUTER_ITERATIONS = 8;
+
+// Some dependent integer arithmetic the compiler can't elide
+inline uint64_t spin(uint64_t seed, size_t cycles)
+{
+    for (size_t i = 0; i < cycles; ++i) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+    }
+    return seed;
+}
+
+template <ParallelFor parallel_for> void startup(State& state)
+{
+    const size_t num_cpus = bb::get_num_cpus();
+    std::vector<uint64_t> results(num_cpus);
+    for (auto _ : state) {
+        parallel_for(num_cpus, [&](size_t i) { results[i] = spin(i + 1, 16); });
+    }
+    DoNotOptimize(results);
+}
+
+template <ParallelFor parallel_for> void uniform(State& state)
+{
+    const auto num_iterations = static_cast<size_t>(1 << state.range(0));
+    std::vector<uint64_t> results(num_iterations);
+    for (auto _ : state) {
+        parallel_for(num_iterations, [&](size_t i) { results[i] = spin(i + 1, 256); });
+    }
+    DoNotOptimize(results);
+}
+
+template <ParallelFor parallel_for> void skewed(State& state)
+{
+    const auto num_iterations = static_cast<size_t>(1 << state.range(0));
+    std::vector<uint64_t> results(num_iterations);
+    for (auto _ : state) {
+        parallel_for(num_iterations, [&](size_t i) { results[i] = spin(i + 1, 4 * i); });
+    }
+    DoNotOptimize(results);
+}
+
+template <ParallelFor parallel_for> void nested_flattened(State& state)
+{
+    const auto num_inner = static_cast<size_t>(1 << state.range(0));
+    std::vector<uint64_t> results(NESTED_OUTER_ITERATIONS * num_inner);
+    for (auto _ : state) {
+        parallel_for(results.size(), [&](size_t i) { results[i] = spin(i + 1, 256); });
+    }
+    DoNotOptimize(results);
+}
+
+void nested_work_stealing(State& state)
+{
+    const auto num_inner = static_cast<size_t>(1 << state.range(0));
+    std::vector<uint64_t> results(NESTED_OUTER_ITERATIONS * num_inner);
+    for (auto _ : state) {
+        bb::parallel_for_work_stealing(NESTED_OUTER_ITERATIONS, [&](size_t outer) {
+            bb::parallel_for_work_stealing(num_inner, [&](size_t inner) {
+                const size_t i = outer * num_inner + inner;
+                results[i] = spin(i + 1, 256);
+            });
+        });
+    }
+    DoNotOptimize(results);
+}
+
+/**
+ * @brief Two independent stages each running a parallel loop, followed by a stage depending on both.
+ */
+void task_graph(State& state)
+{
+    const auto num_iterations = static_cast<size_t>(1 << state.range(0));
+    std::vector<uint64_t> a(num_iterations);
+    std::vector<uint64_t> b(num_iterations);
+    uint64_t result = 0;
+    for (auto _ : state) {
+        bb::TaskGraph graph;
+        auto stage_a = graph.add_task(
+            [&] { bb::parallel_for(num_iterations, [&](size_t i) { a[i] = spin(i + 1, 256); }); });
+        auto stage_b = graph.add_task(
+            [&] { bb::parallel_for(num_iterations, [&](size_t i) { b[i] = spin(i + 2, 256); }); });
+        graph.add_task(
+            [&] {
+                for (size_t i = 0; i < num_iterations; ++i) {
+                    result ^= a[i] + b[i];
+                }
+            },
+            { stage_a, stage_b });
+        graph.run();
+    }
+    DoNotOptimize(result);
+}
+
+// Sampling each element with random_element() dominates the setup for large sizes, a quadratic map is enough here
+std::vector<bb::fr> pseudorandom_field_elements(size_t num_elements)
+{
+    std::vector<bb::fr> elements(num_elements);
+    bb::fr element = bb::fr::random_element();
+    for (auto& result : elements) {
+        result = element;
+        element = element.sqr() + bb::fr(1);
+    }
+    return elements;
+}
+
+void reduce_mutex(State& state)
+{
+    const auto elements = pseudorandom_field_elements(static_cast<size_t>(1 << state.range(0)));
+    for (auto _ : state) {
+        std::mutex mutex;
+        bb::fr result = 0;
+        bb::run_loop_in_parallel(elements.size(), [&](size_t start, size_t end) {
+            bb::fr partial = 0;
+            for (size_t i = start; i < end; ++i) {
+                partial += elements[i] * elements[i];
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            result += partial;
+        });
+        DoNotOptimize(result);
+    }
+}
+
+void reduce_padded(State& state)
+{
+    const auto elements = pseudorandom_field_elements(static_cast<size_t>(1 << state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(bb::parallel_transform_reduce(
+            elements.size(), bb::fr(0), [&](size_t i) { return elements[i] * elements[i]; }));
+    }
+}
+} // namespace
+
+BENCHMARK(startup<bb::parallel_for_mutex_pool>)->Unit(kMicrosecond);
+BENCHMARK(startup<bb::parallel_for_moody>)->Unit(kMicrosecond);
+BENCHMARK(startup<bb::parallel_for_work_stealing>)->Unit(kMicrosecond);
+BENCHMARK(uniform<bb::parallel_for_mutex_pool>)->Unit(kMicrosecond)->DenseRange(10, 16, 2);
+BENCHMARK(uniform<bb::parallel_for_moody>)->Unit(kMicrosecond)->DenseRange(10, 16, 2);
+BENCHMARK(uniform<bb::parallel_for_work_stealing>)->Unit(kMicrosecond)->DenseRange(10, 16, 2);
+BENCHMARK(skewed<bb::parallel_for_mutex_pool>)->Unit(kMicrosecond)->DenseRange(8, 12, 2);
+BENCHMARK(skewed<bb::parallel_for_moody>)->Unit(kMicrosecond)->DenseRange(8, 12, 2);
+BENCHMARK(skewed<bb::parallel_for_work_stealing>)->Unit(kMicrosecond)->DenseRange(8, 12, 2);
+BENCHMARK(nested_flattened<bb::parallel_for_mutex_pool>)->Unit(kMicrosecond)->DenseRange(8, 12, 2);
+BENCHMARK(nested_flattened<bb::parallel_for_moody>)->Unit(kMicrosecond)->DenseRange(8, 12, 2);
+BENCHMARK(nested_work_stealing)->Unit(kMicrosecond)->DenseRange(8, 12, 2);
+BENCHMARK(task_graph)->Unit(kMicrosecond)->DenseRange(10, 16, 2);
+BENCHMARK(reduce_mutex)->Unit(kMicrosecond)->DenseRange(12, 20, 4);
+BENCHMARK(reduce_padded)->Unit(kMicrosecond)->DenseRange(12, 20, 4);
+BENCHMARK_MAIN();
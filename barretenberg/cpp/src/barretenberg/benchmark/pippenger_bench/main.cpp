@@ -1,5 +1,6 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
@@ -49,6 +50,8 @@ static bb::evaluation_domain large_domain;
 const auto init = []() {
     small_domain = bb::evaluation_domain(NUM_POINTS);
     large_domain = bb::evaluation_domain(NUM_POINTS * 4);
+    small_domain.compute_lookup_table();
+    large_domain.compute_lookup_table();
 
     fr element = fr::random_element();
     fr accumulator = element;
@@ -80,6 +83,28 @@ int pippenger()
     return 0;
 }
 
+/**
+ * Same msm as above, using fixed-base tables that are loaded from (or, on first run, written to) the srs directory.
+ * The reported time excludes loading the tables.
+ */
+int fixed_base_pippenger(const size_t num_tables)
+{
+    std::chrono::steady_clock::time_point load_start = std::chrono::steady_clock::now();
+    auto table = reference_string->get_fixed_base_point_table(num_tables);
+    scalar_multiplication::fixed_base_runtime_state<curve::BN254> state(NUM_POINTS, num_tables);
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    g1::element result =
+        scalar_multiplication::fixed_base_pippenger_unsafe<curve::BN254>(&scalars[0], table, NUM_POINTS, state);
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+    std::chrono::microseconds load_diff = std::chrono::duration_cast<std::chrono::microseconds>(time_start - load_start);
+    std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+    std::cout << "tables: " << num_tables << " (" << (table.size_in_bytes() >> 20) << "MiB, bucket width "
+              << table.bits_per_bucket << "), load time: " << load_diff.count() << "us, run time: " << diff.count()
+              << "us" << std::endl;
+    std::cout << result.x << std::endl;
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -115,5 +140,10 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "executing fixed-base pippenger algorithm" << std::endl;
+    for (size_t num_tables = 2; num_tables <= 8; num_tables *= 2) {
+        fixed_base_pippenger(num_tables);
+        fixed_base_pippenger(num_tables);
+    }
     return 0;
 }
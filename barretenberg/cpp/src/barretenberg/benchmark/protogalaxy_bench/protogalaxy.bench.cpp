@@ -39,8 +39,43 @@ template <typename Flavor> void fold_one(State& state) noexcept
     }
 }
 
+// Fold NUM_INSTANCES - 1 instances into an accumulator at once.
+template <typename Flavor, size_t NUM_INSTANCES> void fold_k(State& state) noexcept
+{
+    using ProverInstance = ProverInstance_<Flavor>;
+    using Instances = ProverInstances_<Flavor, NUM_INSTANCES>;
+    using ProtoGalaxyProver = ProtoGalaxyProver_<Instances>;
+    using Builder = typename Flavor::CircuitBuilder;
+
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+
+    std::vector<std::shared_ptr<ProverInstance>> instances;
+    for (size_t idx = 0; idx < NUM_INSTANCES; idx++) {
+        Builder builder;
+        MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+        instances.emplace_back(std::make_shared<ProverInstance>(builder));
+    }
+
+    ProtoGalaxyProver folding_prover(instances);
+
+    for (auto _ : state) {
+        auto proof = folding_prover.fold_instances();
+    }
+    // The time of a fold per folded instance, which batching amortizes
+    state.counters["time_per_instance"] =
+        Counter(static_cast<double>(NUM_INSTANCES - 1), Counter::kIsIterationInvariantRate | Counter::kInvert);
+}
+
 BENCHMARK(fold_one<UltraFlavor>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
 BENCHMARK(fold_one<GoblinUltraFlavor>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraFlavor, 2>)->/* vary the circuit size */ DenseRange(14, 18)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraFlavor, 3>)->/* vary the circuit size */ DenseRange(14, 18)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraFlavor, 4>)->/* vary the circuit size */ DenseRange(14, 18)->Unit(kMillisecond);
+BENCHMARK(fold_k<GoblinUltraFlavor, 2>)->/* vary the circuit size */ DenseRange(14, 18)->Unit(kMillisecond);
+BENCHMARK(fold_k<GoblinUltraFlavor, 3>)->/* vary the circuit size */ DenseRange(14, 18)->Unit(kMillisecond);
+BENCHMARK(fold_k<GoblinUltraFlavor, 4>)->/* vary the circuit size */ DenseRange(14, 18)->Unit(kMillisecond);
 } // namespace bb
 
 BENCHMARK_MAIN();
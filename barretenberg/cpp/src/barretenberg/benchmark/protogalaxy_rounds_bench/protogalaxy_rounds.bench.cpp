@@ -44,6 +44,41 @@ void _bench_round(::benchmark::State& state, void (*F)(ProtoGalaxyProver_<Prover
     }
 }
 
+/**
+ * @brief Benchmark the perturbator round of a fold into an accumulator produced by a previous fold, either reusing the
+ * full Honk evaluations the previous fold cached on the accumulator or recomputing them
+ */
+template <typename Flavor> void bench_perturbator_round(::benchmark::State& state)
+{
+    using Builder = typename Flavor::CircuitBuilder;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using Instances = ProverInstances_<Flavor, 2>;
+    using ProtoGalaxyProver = ProtoGalaxyProver_<Instances>;
+
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+    const bool use_cached_evaluations = state.range(1) != 0;
+
+    const auto construct_instance = [&]() {
+        Builder builder;
+        MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+        return std::make_shared<ProverInstance>(builder);
+    };
+
+    ProtoGalaxyProver first_folding_prover({ construct_instance(), construct_instance() });
+    auto accumulator = first_folding_prover.fold_instances().accumulator;
+    if (!use_cached_evaluations) {
+        accumulator->full_honk_evaluations.clear();
+    }
+
+    ProtoGalaxyProver folding_prover({ accumulator, construct_instance() });
+    folding_prover.preparation_round();
+
+    for (auto _ : state) {
+        folding_prover.perturbator_round();
+    }
+}
+
 void bench_round_ultra(::benchmark::State& state, void (*F)(ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 2>>&))
 {
     _bench_round<UltraFlavor>(state, F);
@@ -73,6 +108,11 @@ BENCHMARK_CAPTURE(bench_round_goblin_ultra, combiner_quotient, [](auto& prover)
 BENCHMARK_CAPTURE(bench_round_goblin_ultra, accumulator_update, [](auto& prover) { prover.accumulator_update_round(); })
     -> DenseRange(14, 20) -> Unit(kMillisecond);
 
+BENCHMARK(bench_perturbator_round<UltraFlavor>)
+    -> ArgsProduct({ benchmark::CreateDenseRange(14, 20, 1), { 0, 1 } }) -> Unit(kMillisecond);
+BENCHMARK(bench_perturbator_round<GoblinUltraFlavor>)
+    -> ArgsProduct({ benchmark::CreateDenseRange(14, 20, 1), { 0, 1 } }) -> Unit(kMillisecond);
+
 } // namespace bb
 
 BENCHMARK_MAIN();
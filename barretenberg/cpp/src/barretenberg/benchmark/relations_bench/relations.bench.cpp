@@ -31,6 +31,41 @@ template <typename Flavor, typename Relation> void execute_relation(::benchmark:
         Relation::accumulate(accumulator, new_value, params, 1);
     }
 }
+/**
+ * @brief Accumulate a relation over univariate edges as the sumcheck prover does, into Accumulators
+ */
+template <typename Flavor, typename Relation, typename Accumulators>
+void execute_relation_for_univariates(::benchmark::State& state)
+{
+    using FF = typename Flavor::FF;
+    using ExtendedEdges = typename Flavor::ExtendedEdges;
+
+    auto params = bb::RelationParameters<FF>::get_random();
+    ExtendedEdges edges;
+    for (auto& edge : edges.get_all()) {
+        edge = std::remove_reference_t<decltype(edge)>::get_random();
+    }
+    const auto scaling_factor = FF::random_element();
+    Accumulators accumulators{};
+
+    for (auto _ : state) {
+        Relation::accumulate(accumulators, edges, params, scaling_factor);
+    }
+}
+
+// The sumcheck prover's accumulation with and without deferred reductions
+template <typename Flavor, typename Relation> void accumulate_univariates(::benchmark::State& state)
+{
+    execute_relation_for_univariates<Flavor, Relation, typename Relation::SumcheckTupleOfUnivariatesOverSubrelations>(
+        state);
+}
+template <typename Flavor, typename Relation> void accumulate_unreduced_univariates(::benchmark::State& state)
+{
+    execute_relation_for_univariates<Flavor,
+                                     Relation,
+                                     typename Relation::SumcheckTupleOfUnreducedUnivariatesOverSubrelations>(state);
+}
+
 BENCHMARK(execute_relation<UltraFlavor, UltraArithmeticRelation<Fr>>);
 BENCHMARK(execute_relation<UltraFlavor, GenPermSortRelation<Fr>>);
 BENCHMARK(execute_relation<UltraFlavor, EllipticRelation<Fr>>);
@@ -40,6 +75,25 @@ BENCHMARK(execute_relation<UltraFlavor, UltraPermutationRelation<Fr>>);
 
 BENCHMARK(execute_relation<GoblinUltraFlavor, EccOpQueueRelation<Fr>>);
 
+BENCHMARK(accumulate_univariates<UltraFlavor, UltraArithmeticRelation<Fr>>);
+BENCHMARK(accumulate_unreduced_univariates<UltraFlavor, UltraArithmeticRelation<Fr>>);
+BENCHMARK(accumulate_univariates<UltraFlavor, GenPermSortRelation<Fr>>);
+BENCHMARK(accumulate_unreduced_univariates<UltraFlavor, GenPermSortRelation<Fr>>);
+BENCHMARK(accumulate_univariates<UltraFlavor, EllipticRelation<Fr>>);
+BENCHMARK(accumulate_unreduced_univariates<UltraFlavor, EllipticRelation<Fr>>);
+BENCHMARK(accumulate_univariates<UltraFlavor, AuxiliaryRelation<Fr>>);
+BENCHMARK(accumulate_unreduced_univariates<UltraFlavor, AuxiliaryRelation<Fr>>);
+BENCHMARK(accumulate_univariates<UltraFlavor, LookupRelation<Fr>>);
+BENCHMARK(accumulate_unreduced_univariates<UltraFlavor, LookupRelation<Fr>>);
+BENCHMARK(accumulate_univariates<UltraFlavor, UltraPermutationRelation<Fr>>);
+BENCHMARK(accumulate_unreduced_univariates<UltraFlavor, UltraPermutationRelation<Fr>>);
+BENCHMARK(accumulate_univariates<GoblinUltraFlavor, EccOpQueueRelation<Fr>>);
+BENCHMARK(accumulate_unreduced_univariates<GoblinUltraFlavor, EccOpQueueRelation<Fr>>);
+BENCHMARK(accumulate_univariates<GoblinUltraFlavor, Poseidon2ExternalRelation<Fr>>);
+BENCHMARK(accumulate_unreduced_univariates<GoblinUltraFlavor, Poseidon2ExternalRelation<Fr>>);
+BENCHMARK(accumulate_univariates<GoblinUltraFlavor, Poseidon2InternalRelation<Fr>>);
+BENCHMARK(accumulate_unreduced_univariates<GoblinUltraFlavor, Poseidon2InternalRelation<Fr>>);
+
 BENCHMARK(execute_relation<GoblinTranslatorFlavor, GoblinTranslatorDecompositionRelation<Fr>>);
 BENCHMARK(execute_relation<GoblinTranslatorFlavor, GoblinTranslatorOpcodeConstraintRelation<Fr>>);
 BENCHMARK(execute_relation<GoblinTranslatorFlavor, GoblinTranslatorAccumulatorTransferRelation<Fr>>);
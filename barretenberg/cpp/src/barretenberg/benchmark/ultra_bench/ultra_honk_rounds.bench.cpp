@@ -52,7 +52,11 @@ BB_PROFILE static void test_round_inner(State& state, GoblinUltraProver& prover,
     time_if_index(RELATION_CHECK, [&] { prover.execute_relation_check_rounds(); });
     time_if_index(ZEROMORPH, [&] { prover.execute_zeromorph_rounds(); });
 }
-BB_PROFILE static void test_round(State& state, size_t index) noexcept
+/**
+ * @param num_sumcheck_streaming_rounds - Bound the sumcheck memory such that this many rounds are computed from the
+ * full polynomials, see SumcheckProver::compute_num_streaming_rounds. The default of 1 is the unbounded prover.
+ */
+BB_PROFILE static void test_round(State& state, size_t index, size_t num_sumcheck_streaming_rounds = 1) noexcept
 {
     auto log2_num_gates = static_cast<size_t>(state.range(0));
     bb::srs::init_crs_factory("../srs_db/ignition");
@@ -60,6 +64,11 @@ BB_PROFILE static void test_round(State& state, size_t index) noexcept
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/761) benchmark both sparse and dense circuits
     auto prover = bb::mock_circuits::get_prover<GoblinUltraProver>(
         &bb::mock_circuits::generate_basic_arithmetic_circuit<GoblinUltraCircuitBuilder>, log2_num_gates);
+    if (num_sumcheck_streaming_rounds > 1) {
+        const size_t circuit_size = prover.instance->proving_key->circuit_size;
+        prover.sumcheck_memory_limit = GoblinUltraFlavor::NUM_ALL_ENTITIES *
+                                       (circuit_size >> num_sumcheck_streaming_rounds) * sizeof(GoblinUltraFlavor::FF);
+    }
     for (auto _ : state) {
         state.PauseTiming();
         test_round_inner(state, prover, index);
@@ -84,4 +93,14 @@ ROUND_BENCHMARK(GRAND_PRODUCT_COMPUTATION)->Iterations(1);
 ROUND_BENCHMARK(RELATION_CHECK);
 ROUND_BENCHMARK(ZEROMORPH);
 
+/**
+ * @brief The relation check rounds with sumcheck memory bounded to 1/2^(k-1) of the default, k = range(1). The peak
+ * memory of the prover polynomials plus the partially evaluated polynomials goes from 1.5x to (1 + 1/2^k)x.
+ */
+static void RELATION_CHECK_MEMORY_BOUNDED(State& state) noexcept
+{
+    test_round(state, RELATION_CHECK, static_cast<size_t>(state.range(1)));
+}
+BENCHMARK(RELATION_CHECK_MEMORY_BOUNDED)->ArgsProduct({ { 17, 19 }, { 2, 3, 4 } })->Unit(kMillisecond);
+
 BENCHMARK_MAIN();
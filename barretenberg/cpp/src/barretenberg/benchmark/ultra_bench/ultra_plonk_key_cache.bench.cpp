@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/plonk/proof_system/proving_key/proving_key_cache.hpp"
+#include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+
+#include <filesystem>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+const std::filesystem::path cache_dir = std::filesystem::temp_directory_path() / "bb_key_cache_bench";
+
+/**
+ * @brief Construct an Ultra Plonk proof for a fresh witness of a fixed circuit, computing the proving key with the
+ * given cache
+ * @param clear_cache Empty the cache before each proof, i.e. always prove cold
+ */
+void prove_with_key_cache(State& state, bool clear_cache)
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    const auto log2_num_gates = static_cast<size_t>(state.range(0));
+
+    std::filesystem::remove_all(cache_dir);
+    std::filesystem::create_directories(cache_dir);
+    auto key_cache = std::make_shared<plonk::ProvingKeyCache>(cache_dir.string());
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (clear_cache) {
+            std::filesystem::remove_all(cache_dir);
+            std::filesystem::create_directories(cache_dir);
+        }
+        UltraCircuitBuilder builder;
+        mock_circuits::generate_basic_arithmetic_circuit(builder, log2_num_gates);
+        state.ResumeTiming();
+
+        plonk::UltraComposer composer;
+        composer.key_cache = key_cache;
+        auto prover = composer.create_prover(builder);
+        DoNotOptimize(prover.construct_proof());
+    }
+    state.counters["hits"] = static_cast<double>(key_cache->get_num_hits());
+    state.counters["misses"] = static_cast<double>(key_cache->get_num_misses());
+    std::filesystem::remove_all(cache_dir);
+}
+
+/**
+ * @brief Every proof computes its proving key from scratch and writes it to the cache
+ */
+void prove_cold(State& state)
+{
+    prove_with_key_cache(state, /*clear_cache=*/true);
+}
+
+/**
+ * @brief Every proof but the first reads the precomputed part of its proving key from the cache
+ */
+void prove_warm(State& state)
+{
+    prove_with_key_cache(state, /*clear_cache=*/false);
+}
+
+} // namespace
+
+BENCHMARK(prove_cold)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(prove_warm)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+using FF = UltraFlavor::FF;
+
+/**
+ * @brief Construct an Ultra prover and run the oink rounds so that all of the witness polynomials are populated
+ */
+UltraProver get_prover_with_witness(size_t log2_num_gates)
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    auto prover = bb::mock_circuits::get_prover<UltraProver>(
+        &bb::mock_circuits::generate_basic_arithmetic_circuit<UltraCircuitBuilder>, log2_num_gates);
+    prover.oink_prover.execute_preamble_round();
+    prover.oink_prover.execute_wire_commitments_round();
+    prover.oink_prover.execute_sorted_list_accumulator_round();
+    prover.oink_prover.execute_log_derivative_inverse_round();
+    prover.oink_prover.execute_grand_product_computation_round();
+    return prover;
+}
+
+/**
+ * @brief Commit to each witness polynomial (w_l, w_r, w_o, w_4, sorted_accum, z_perm, z_lookup) one at a time
+ */
+void commit_witness_sequential(State& state)
+{
+    auto prover = get_prover_with_witness(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (auto& polynomial : prover.instance->proving_key->get_witness()) {
+            DoNotOptimize(prover.commitment_key->commit(polynomial));
+        }
+    }
+}
+
+/**
+ * @brief Commit to the same witness polynomials with a single batch_commit call
+ */
+void commit_witness_batched(State& state)
+{
+    auto prover = get_prover_with_witness(static_cast<size_t>(state.range(0)));
+    std::vector<std::span<const FF>> polynomials;
+    for (auto& polynomial : prover.instance->proving_key->get_witness()) {
+        polynomials.emplace_back(polynomial);
+    }
+    for (auto _ : state) {
+        DoNotOptimize(prover.commitment_key->batch_commit(polynomials));
+    }
+}
+} // namespace
+
+BENCHMARK(commit_witness_sequential)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(commit_witness_batched)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
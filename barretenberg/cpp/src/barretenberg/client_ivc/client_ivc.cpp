@@ -11,21 +11,113 @@ namespace bb {
 void ClientIVC::initialize(ClientCircuit& circuit)
 {
     goblin.merge(circuit); // Construct new merge proof
-    prover_fold_output.accumulator = std::make_shared<ProverInstance>(circuit);
+    prover_fold_output.accumulator = std::make_shared<ProverInstance>(circuit, trace_structure);
 }
 
 /**
  * @brief Accumulate a circuit into the IVC scheme
- * @details Performs goblin merge, generates circuit instance, folds into accumulator and constructs a folding proof
+ * @details Performs goblin merge and generates circuit instance. Once fold_batch_size instances are pending, folds them
+ * into the accumulator and constructs a folding proof.
  *
  * @param circuit Circuit to be accumulated/folded
- * @return FoldProof
+ * @return FoldProof The folding proof, or an empty proof if the instance is pending
  */
 ClientIVC::FoldProof ClientIVC::accumulate(ClientCircuit& circuit)
 {
+    if (fold_batch_size == 0 || fold_batch_size > MAX_FOLD_BATCH_SIZE) {
+        throw_or_abort("ClientIVC: unsupported fold batch size " + std::to_string(fold_batch_size));
+    }
+    wait_for_in_flight_folds();
+    goblin.merge(circuit); // Add recursive merge verifier and construct new merge proof
+    prover_instance = std::make_shared<ProverInstance>(circuit, trace_structure);
+    pending_instances.emplace_back(prover_instance);
+    if (pending_instances.size() < fold_batch_size) {
+        return {};
+    }
+    return fold_pending_instances();
+}
+
+#ifndef NO_MULTITHREADING
+/**
+ * @brief Accumulate a circuit into the IVC scheme, constructing its instance and folding it in the background
+ * @details The goblin merge and the completion of the circuit append to the op queue, which the caller appends to as
+ * it constructs the next circuits, so they are performed before returning. The construction of the instance starts
+ * right away, overlapping the folds still in flight, and the fold starts once the previous one has completed. At most
+ * max_in_flight_instances circuits are in flight: beyond that, this waits for the oldest fold first.
+ *
+ * @param circuit Circuit to be accumulated/folded, which must outlive the construction of its instance
+ * @return The folding proof, once the fold has completed
+ */
+std::shared_future<ClientIVC::FoldProof> ClientIVC::accumulate_async(ClientCircuit& circuit)
+{
+    if (fold_batch_size != 1 || !pending_instances.empty()) {
+        throw_or_abort("ClientIVC: asynchronous accumulation folds one circuit at a time");
+    }
+    while (!in_flight_folds.empty() && in_flight_folds.size() >= max_in_flight_instances) {
+        in_flight_folds.front().wait();
+        in_flight_folds.pop_front();
+    }
+
     goblin.merge(circuit); // Add recursive merge verifier and construct new merge proof
-    prover_instance = std::make_shared<ProverInstance>(circuit);
-    FoldingProver folding_prover({ prover_fold_output.accumulator, prover_instance });
+    ProverInstance::finalize_circuit(circuit);
+
+    auto instance = std::async(std::launch::async, [this, &circuit]() {
+        return std::make_shared<ProverInstance>(circuit, trace_structure, /*circuit_is_finalized=*/true);
+    });
+    std::shared_future<FoldProof> previous_fold =
+        in_flight_folds.empty() ? std::shared_future<FoldProof>{} : in_flight_folds.back();
+    auto fold = std::async(std::launch::async, [this, previous_fold, instance = std::move(instance)]() mutable {
+                    if (previous_fold.valid()) {
+                        previous_fold.wait();
+                    }
+                    prover_instance = instance.get();
+                    FoldingProver folding_prover({ prover_fold_output.accumulator, prover_instance });
+                    prover_fold_output = folding_prover.fold_instances();
+                    return prover_fold_output.folding_data;
+                }).share();
+    in_flight_folds.push_back(fold);
+    return fold;
+}
+#endif
+
+/**
+ * @brief Wait for the folds of the circuits accumulated asynchronously to complete
+ */
+void ClientIVC::wait_for_in_flight_folds()
+{
+#ifndef NO_MULTITHREADING
+    for (auto& fold : in_flight_folds) {
+        fold.wait();
+    }
+    in_flight_folds.clear();
+#endif
+}
+
+/**
+ * @brief Fold the pending instances into the accumulator with a single folding proof
+ *
+ * @return FoldProof
+ */
+ClientIVC::FoldProof ClientIVC::fold_pending_instances()
+{
+    switch (pending_instances.size()) {
+    case 1:
+        return fold<2>();
+    case 2:
+        return fold<3>();
+    case 3:
+        return fold<4>();
+    default:
+        throw_or_abort("ClientIVC: cannot fold " + std::to_string(pending_instances.size()) + " instances at once");
+    }
+}
+
+template <size_t NUM_INSTANCES> ClientIVC::FoldProof ClientIVC::fold()
+{
+    std::vector<std::shared_ptr<ProverInstance>> instances{ prover_fold_output.accumulator };
+    instances.insert(instances.end(), pending_instances.begin(), pending_instances.end());
+    pending_instances.clear();
+    ProtoGalaxyProver_<ProverInstances_<Flavor, NUM_INSTANCES>> folding_prover(instances);
     prover_fold_output = folding_prover.fold_instances();
     return prover_fold_output.folding_data;
 }
@@ -37,6 +129,10 @@ ClientIVC::FoldProof ClientIVC::accumulate(ClientCircuit& circuit)
  */
 ClientIVC::Proof ClientIVC::prove()
 {
+    wait_for_in_flight_folds();
+    if (!pending_instances.empty()) {
+        fold_pending_instances();
+    }
     return { prover_fold_output.folding_data, decider_prove(), goblin.prove() };
 }
 
@@ -51,15 +147,36 @@ bool ClientIVC::verify(Proof& proof, const std::vector<VerifierAccumulator>& ver
     // Goblin verification (merge, eccvm, translator)
     bool goblin_verified = goblin.verify(proof.goblin_proof);
 
-    // Decider verification
-    ClientIVC::FoldingVerifier folding_verifier({ verifier_instances[0], verifier_instances[1] });
-    auto verifier_accumulator = folding_verifier.verify_folding_proof(proof.fold_proof);
+    // Decider verification, of the accumulator produced by the last fold of one or several instances
+    VerifierAccumulator verifier_accumulator;
+    switch (verifier_instances.size()) {
+    case 2:
+        verifier_accumulator = verify_folding_proof<2>(proof.fold_proof, verifier_instances);
+        break;
+    case 3:
+        verifier_accumulator = verify_folding_proof<3>(proof.fold_proof, verifier_instances);
+        break;
+    case 4:
+        verifier_accumulator = verify_folding_proof<4>(proof.fold_proof, verifier_instances);
+        break;
+    default:
+        throw_or_abort("ClientIVC: cannot verify a fold of " + std::to_string(verifier_instances.size()) +
+                       " instances");
+    }
 
     ClientIVC::DeciderVerifier decider_verifier(verifier_accumulator);
     bool decision = decider_verifier.verify_proof(proof.decider_proof);
     return goblin_verified && decision;
 }
 
+template <size_t NUM_INSTANCES>
+ClientIVC::VerifierAccumulator ClientIVC::verify_folding_proof(const FoldProof& fold_proof,
+                                                               const std::vector<VerifierAccumulator>& verifier_instances)
+{
+    ProtoGalaxyVerifier_<VerifierInstances_<Flavor, NUM_INSTANCES>> folding_verifier(verifier_instances);
+    return folding_verifier.verify_folding_proof(fold_proof);
+}
+
 /**
  * @brief Internal method for constructing a decider proof
  *
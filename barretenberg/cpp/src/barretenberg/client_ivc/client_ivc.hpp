@@ -8,6 +8,11 @@
 #include "barretenberg/protogalaxy/protogalaxy_verifier.hpp"
 #include "barretenberg/sumcheck/instance/instances.hpp"
 
+#ifndef NO_MULTITHREADING
+#include <deque>
+#include <future>
+#endif
+
 namespace bb {
 
 /**
@@ -49,11 +54,25 @@ class ClientIVC {
         std::shared_ptr<VerificationKey> kernel_vk;
     };
 
+    // The largest number of circuits that can be folded into the accumulator at once
+    static constexpr size_t MAX_FOLD_BATCH_SIZE = 3;
+
   private:
     using ProverFoldOutput = FoldingResult<Flavor>;
     // Note: We need to save the last instance that was folded in order to compute its verification key, this will not
     // be needed in the real IVC as they are provided as inputs
 
+#ifndef NO_MULTITHREADING
+    // The folds of the circuits accumulated asynchronously that may not have completed, oldest first
+    std::deque<std::shared_future<FoldProof>> in_flight_folds;
+#endif
+
+    template <size_t NUM_INSTANCES> FoldProof fold();
+
+    template <size_t NUM_INSTANCES>
+    static VerifierAccumulator verify_folding_proof(const FoldProof& fold_proof,
+                                                    const std::vector<VerifierAccumulator>& verifier_instances);
+
   public:
     Goblin goblin;
     ProverFoldOutput prover_fold_output;
@@ -63,10 +82,32 @@ class ClientIVC {
     // be needed in the real IVC as they are provided as inputs
     std::shared_ptr<ProverInstance> prover_instance;
 
+    // The layout of the execution trace of the accumulated circuits. With a structured trace, every circuit has the
+    // same size and the same location for each type of gate.
+    TraceStructure trace_structure = TraceStructure::NONE;
+
+    // The number of circuits folded into the accumulator at once. Accumulated circuits are buffered as instances until
+    // there are this many, which amortizes the perturbator, the combiner and the folding of the accumulator over them.
+    // Folds of several instances can only be verified natively: the recursive folding verifier folds one at a time.
+    size_t fold_batch_size = 1;
+    std::vector<std::shared_ptr<ProverInstance>> pending_instances;
+
+    // The largest number of circuits accumulated asynchronously whose instances are being constructed or folded. Each
+    // of them holds the polynomials of an instance, so this bounds the memory of the pipeline.
+    size_t max_in_flight_instances = 2;
+
     void initialize(ClientCircuit& circuit);
 
     FoldProof accumulate(ClientCircuit& circuit);
 
+    FoldProof fold_pending_instances();
+
+#ifndef NO_MULTITHREADING
+    std::shared_future<FoldProof> accumulate_async(ClientCircuit& circuit);
+#endif
+
+    void wait_for_in_flight_folds();
+
     Proof prove();
 
     bool verify(Proof& proof, const std::vector<VerifierAccumulator>& verifier_instances);
@@ -4,6 +4,7 @@
 #include "barretenberg/proof_system/circuit_builder/goblin_ultra_circuit_builder.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
 
+#include <deque>
 #include <gtest/gtest.h>
 using namespace bb;
 
@@ -154,4 +155,75 @@ TEST_F(ClientIVCTests, Full)
     auto inst = std::make_shared<VerifierInstance>(kernel_vk);
     // Verify all four proofs
     EXPECT_TRUE(ivc.verify(proof, { foo_verifier_instance, inst }));
-};
\ No newline at end of file
+};
+/**
+ * @brief Accumulate circuits in batches folded at once and verify the resulting IVC proof
+ *
+ */
+TEST_F(ClientIVCTests, BatchedAccumulation)
+{
+    using VerificationKey = Flavor::VerificationKey;
+
+    ClientIVC ivc;
+    Builder initial_circuit = create_mock_circuit(ivc);
+    ivc.initialize(initial_circuit);
+    auto initial_vk = std::make_shared<VerificationKey>(ivc.prover_fold_output.accumulator->proving_key);
+    auto initial_verifier_instance = std::make_shared<VerifierInstance>(initial_vk);
+
+    // Fold a first circuit alone to obtain an accumulator
+    Builder circuit = create_mock_circuit(ivc);
+    FoldProof fold_proof = ivc.accumulate(circuit);
+    auto vk = std::make_shared<VerificationKey>(ivc.prover_instance->proving_key);
+    auto verifier_accumulator = update_accumulator_and_decide_native(
+        ivc.prover_fold_output.accumulator, fold_proof, initial_verifier_instance, vk);
+
+    // Fold three more circuits into it at once; they have the verification key of the first folded circuit
+    ivc.fold_batch_size = 3;
+    for (size_t idx = 0; idx < 3; idx++) {
+        Builder batch_circuit = create_mock_circuit(ivc);
+        fold_proof = ivc.accumulate(batch_circuit);
+        EXPECT_EQ(fold_proof.empty(), idx < 2);
+    }
+
+    auto proof = ivc.prove();
+    std::vector<VerifierAccumulator> verifier_instances{ verifier_accumulator };
+    for (size_t idx = 0; idx < 3; idx++) {
+        verifier_instances.emplace_back(std::make_shared<VerifierInstance>(vk));
+    }
+    EXPECT_TRUE(ivc.verify(proof, verifier_instances));
+};
+
+/**
+ * @brief Accumulate circuits asynchronously, constructing each while the previous ones are being folded
+ *
+ */
+TEST_F(ClientIVCTests, AsynchronousAccumulation)
+{
+    using VerificationKey = Flavor::VerificationKey;
+
+    ClientIVC ivc;
+    Builder initial_circuit = create_mock_circuit(ivc);
+    ivc.initialize(initial_circuit);
+    auto initial_vk = std::make_shared<VerificationKey>(ivc.prover_fold_output.accumulator->proving_key);
+    VerifierAccumulator verifier_accumulator = std::make_shared<VerifierInstance>(initial_vk);
+
+    // The circuits must outlive the construction of their instances
+    std::deque<Builder> circuits;
+    std::vector<std::shared_future<FoldProof>> fold_proofs;
+    const size_t NUM_CIRCUITS = 3;
+    for (size_t idx = 0; idx < NUM_CIRCUITS; idx++) {
+        circuits.emplace_back(create_mock_circuit(ivc));
+        fold_proofs.emplace_back(ivc.accumulate_async(circuits.back()));
+    }
+    ivc.wait_for_in_flight_folds();
+    auto vk = std::make_shared<VerificationKey>(ivc.prover_instance->proving_key);
+
+    // Verify all but the last folding proof natively; the last one is verified as part of the IVC proof
+    for (size_t idx = 0; idx < NUM_CIRCUITS - 1; idx++) {
+        FoldingVerifier folding_verifier({ verifier_accumulator, std::make_shared<VerifierInstance>(vk) });
+        verifier_accumulator = folding_verifier.verify_folding_proof(fold_proofs[idx].get());
+    }
+
+    auto proof = ivc.prove();
+    EXPECT_TRUE(ivc.verify(proof, { verifier_accumulator, std::make_shared<VerifierInstance>(vk) }));
+};
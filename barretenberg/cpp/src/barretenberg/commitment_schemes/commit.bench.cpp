@@ -1,5 +1,6 @@
-
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/proof_system/circuit_builder/mock_circuits.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include <benchmark/benchmark.h>
 
@@ -16,6 +17,38 @@ constexpr size_t MAX_NUM_POINTS = 1 << MAX_LOG_NUM_POINTS;
 
 auto key = create_commitment_key<curve::BN254>(MAX_NUM_POINTS);
 
+/**
+ * @brief The selectors of a mock goblin ultra circuit (some ecc ops followed by arithmetic gates), laid out in trace
+ * order and padded to a power of two
+ */
+std::vector<Polynomial<fr>> construct_mock_selectors(const size_t log_num_gates)
+{
+    GoblinUltraCircuitBuilder builder;
+    MockCircuits::construct_goblin_ecc_op_circuit(builder);
+    MockCircuits::construct_arithmetic_circuit(builder, log_num_gates);
+
+    size_t num_rows = 0;
+    for (auto& block : builder.blocks.get()) {
+        num_rows += block.size();
+    }
+    const size_t dyadic_size = 1UL << (numeric::get_msb(num_rows - 1) + 1);
+
+    std::vector<Polynomial<fr>> selectors(GoblinUltraCircuitBuilder::Arithmetization::NUM_SELECTORS);
+    for (auto& selector : selectors) {
+        selector = Polynomial<fr>(dyadic_size);
+    }
+    size_t offset = 0;
+    for (auto& block : builder.blocks.get()) {
+        for (size_t i = 0; i < selectors.size(); ++i) {
+            for (size_t row = 0; row < block.size(); ++row) {
+                selectors[i][offset + row] = block.selectors[i][row];
+            }
+        }
+        offset += block.size();
+    }
+    return selectors;
+}
+
 template <typename Curve> void bench_commit(::benchmark::State& state)
 {
     const size_t num_points = 1 << state.range(0);
@@ -25,7 +58,49 @@ template <typename Curve> void bench_commit(::benchmark::State& state)
     }
 }
 
+void bench_commit_selectors(::benchmark::State& state)
+{
+    const auto selectors = construct_mock_selectors(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& selector : selectors) {
+            benchmark::DoNotOptimize(key->commit(selector));
+        }
+    }
+}
+
+void bench_commit_sparse_selectors(::benchmark::State& state)
+{
+    const auto selectors = construct_mock_selectors(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& selector : selectors) {
+            benchmark::DoNotOptimize(key->commit_sparse(selector));
+        }
+    }
+}
+
+/**
+ * @brief A column that is 3/4 zeros, 1/8 small values and 1/8 random, e.g. a lookup read counts column
+ */
+void bench_commit_sparse_mixed(::benchmark::State& state)
+{
+    const size_t num_points = 1 << state.range(0);
+    auto polynomial = Polynomial<fr>(num_points);
+    for (size_t i = 0; i < num_points; i += 8) {
+        polynomial[i] = fr::random_element();
+        polynomial[i + 1] = fr(i & 0xff);
+    }
+    const bool sparse = state.range(1) != 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sparse ? key->commit_sparse(polynomial) : key->commit(polynomial));
+    }
+}
+
 BENCHMARK(bench_commit<curve::BN254>)->DenseRange(10, MAX_LOG_NUM_POINTS)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_selectors)->DenseRange(12, 20, 2)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_sparse_selectors)->DenseRange(12, 20, 2)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_sparse_mixed)
+    ->ArgsProduct({ benchmark::CreateDenseRange(12, 20, 2), { 0, 1 } })
+    ->Unit(benchmark::kMillisecond);
 
 } // namespace bb
 
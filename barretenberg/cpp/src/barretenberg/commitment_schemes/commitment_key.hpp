@@ -8,6 +8,8 @@
  */
 
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -19,6 +21,7 @@
 #include <cstddef>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -34,11 +37,21 @@ template <class Curve> class CommitmentKey {
 
     using Fr = typename Curve::ScalarField;
     using Commitment = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
 
   public:
+    // Coefficients below 2^SMALL_SCALAR_BITS are accumulated into one bucket per value by commit_sparse
+    static constexpr size_t SMALL_SCALAR_BITS = 8;
+
     scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
     std::shared_ptr<srs::factories::ProverCrs<Curve>> srs;
+    // Only set when using the fixed-base strategy, see use_fixed_base_tables
+    std::shared_ptr<scalar_multiplication::fixed_base_point_table<Curve>> fixed_base_table;
+    std::shared_ptr<scalar_multiplication::fixed_base_runtime_state<Curve>> fixed_base_runtime_state;
+    // Only set once batch_commit has been used
+    std::shared_ptr<scalar_multiplication::pippenger_runtime_state<Curve>> batch_runtime_state;
 
     CommitmentKey() = delete;
 
@@ -72,9 +85,183 @@ template <class Curve> class CommitmentKey {
         BB_OP_COUNT_TIME();
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
+        if (fixed_base_table) {
+            return scalar_multiplication::fixed_base_pippenger_unsafe<Curve>(
+                const_cast<Fr*>(polynomial.data()), *fixed_base_table, degree, *fixed_base_runtime_state);
+        }
         return scalar_multiplication::pippenger_unsafe<Curve>(
             const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
     };
+
+    /**
+     * @brief Commits to several polynomials, returning the same commitments as calling commit() on each of them.
+     *
+     * @details The MSMs are pipelined (see scalar_multiplication::pippenger_batch_unsafe): the bucket sort of the next
+     * polynomial overlaps with the bucket accumulation of the current one. This uses a second runtime state, which is
+     * allocated on first use and kept for later batches.
+     */
+    std::vector<Commitment> batch_commit(std::span<const std::span<const Fr>> polynomials)
+    {
+        BB_OP_COUNT_TIME();
+        std::vector<Commitment> commitments;
+        commitments.reserve(polynomials.size());
+        for (const auto& polynomial : polynomials) {
+            ASSERT(polynomial.size() <= srs->get_monomial_size());
+        }
+        // The fixed-base MSM has its own runtime state and no separate sorting phase to overlap
+        if (fixed_base_table) {
+            for (const auto& polynomial : polynomials) {
+                commitments.emplace_back(commit(polynomial));
+            }
+            return commitments;
+        }
+        if (!batch_runtime_state) {
+            batch_runtime_state = std::make_shared<scalar_multiplication::pippenger_runtime_state<Curve>>(
+                pippenger_runtime_state.num_points / 2);
+        }
+        std::vector<Element> results(polynomials.size());
+        scalar_multiplication::pippenger_batch_unsafe<Curve>(
+            polynomials, srs->get_monomial_points(), pippenger_runtime_state, *batch_runtime_state, results);
+        for (const auto& result : results) {
+            commitments.emplace_back(result);
+        }
+        return commitments;
+    }
+
+    /**
+     * @brief Commit to a polynomial whose coefficients are mostly zero or small, e.g. selectors, ecc op wires, databus
+     * columns and read counts.
+     *
+     * @details A pre-pass classifies every coefficient:
+     *  - zero: dropped,
+     *  - small (< 2^SMALL_SCALAR_BITS): its point is added into a bucket indexed by the value, the buckets are
+     *    combined with a running sum at the end, i.e. a single pippenger round with no wnaf, sorting or endomorphism,
+     *  - anything else: gathered together with its points into a (smaller) regular pippenger MSM.
+     * If the polynomial turns out to be dense this falls back to commit(), so it is always safe to call.
+     */
+    Commitment commit_sparse(std::span<const Fr> polynomial)
+    {
+        BB_OP_COUNT_TIME();
+        const size_t degree = polynomial.size();
+        ASSERT(degree <= srs->get_monomial_size());
+        constexpr size_t NUM_SMALL_BUCKETS = 1UL << SMALL_SCALAR_BITS;
+
+        const size_t num_threads = calculate_num_threads(degree);
+        const size_t chunk_size = (degree + num_threads - 1) / num_threads;
+        std::vector<size_t> num_general(num_threads, 0);
+        std::vector<size_t> num_small(num_threads, 0);
+
+        const auto is_small = [](const Fr& coefficient, uint64_t& value) {
+            const Fr reduced = coefficient.from_montgomery_form();
+            value = reduced.data[0];
+            return (reduced.data[1] | reduced.data[2] | reduced.data[3]) == 0 && value < NUM_SMALL_BUCKETS;
+        };
+
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = std::min(thread_idx * chunk_size, degree);
+            const size_t end = std::min(start + chunk_size, degree);
+            uint64_t value = 0;
+            for (size_t i = start; i < end; ++i) {
+                if (polynomial[i].is_zero()) {
+                    continue;
+                }
+                if (is_small(polynomial[i], value)) {
+                    ++num_small[thread_idx];
+                } else {
+                    ++num_general[thread_idx];
+                }
+            }
+        });
+
+        size_t total_general = 0;
+        size_t total_small = 0;
+        std::vector<size_t> general_offsets(num_threads, 0);
+        for (size_t i = 0; i < num_threads; ++i) {
+            general_offsets[i] = total_general;
+            total_general += num_general[i];
+            total_small += num_small[i];
+        }
+        // Gathering the general coefficients and their points isn't free, only worth it if it shrinks the MSM a bit
+        if (total_general + (degree >> 3) > degree) {
+            return commit(polynomial);
+        }
+
+        AffineElement* srs_points = srs->get_monomial_points();
+        std::vector<Fr> general_scalars(total_general);
+        // Gathered in pippenger point table layout, i.e. each point followed by its endomorphism
+        std::vector<AffineElement> general_points(total_general * 2);
+        std::vector<std::vector<Element>> small_buckets(num_threads);
+
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = std::min(thread_idx * chunk_size, degree);
+            const size_t end = std::min(start + chunk_size, degree);
+            size_t general_idx = general_offsets[thread_idx];
+            auto& buckets = small_buckets[thread_idx];
+            if (num_small[thread_idx] != 0) {
+                buckets.resize(NUM_SMALL_BUCKETS);
+                for (auto& bucket : buckets) {
+                    bucket.self_set_infinity();
+                }
+            }
+            uint64_t value = 0;
+            for (size_t i = start; i < end; ++i) {
+                if (polynomial[i].is_zero()) {
+                    continue;
+                }
+                if (is_small(polynomial[i], value)) {
+                    buckets[value] += srs_points[i * 2];
+                } else {
+                    general_scalars[general_idx] = polynomial[i];
+                    general_points[general_idx * 2] = srs_points[i * 2];
+                    general_points[general_idx * 2 + 1] = srs_points[i * 2 + 1];
+                    ++general_idx;
+                }
+            }
+        });
+
+        Element result = scalar_multiplication::pippenger_unsafe<Curve>(
+            general_scalars.data(), general_points.data(), total_general, pippenger_runtime_state);
+
+        if (total_small != 0) {
+            // sum_v v * B_v: after adding bucket v, the running sum holds B_v + ... + B_max and is added once more
+            Element running_sum;
+            Element small_result;
+            running_sum.self_set_infinity();
+            small_result.self_set_infinity();
+            for (size_t value = NUM_SMALL_BUCKETS - 1; value > 0; --value) {
+                for (const auto& buckets : small_buckets) {
+                    if (!buckets.empty()) {
+                        running_sum += buckets[value];
+                    }
+                }
+                small_result += running_sum;
+            }
+            result += small_result;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Switches commit() between regular pippenger and a fixed-base MSM over precomputed shifted copies of the
+     * SRS (see fixed_base.hpp). Worthwhile when many commitments are computed against the same SRS.
+     *
+     * @param num_tables The size/speed trade-off: the tables use num_tables times the memory of the SRS (and the
+     * runtime state grows accordingly), in exchange for fewer bucket additions per commitment. 0 switches back to
+     * regular pippenger.
+     */
+    void use_fixed_base_tables(const size_t num_tables)
+    {
+        if (num_tables == 0) {
+            fixed_base_table = nullptr;
+            fixed_base_runtime_state = nullptr;
+            return;
+        }
+        const size_t num_points = srs->get_monomial_size();
+        fixed_base_table = std::make_shared<scalar_multiplication::fixed_base_point_table<Curve>>(
+            srs->get_fixed_base_point_table(num_tables));
+        fixed_base_runtime_state =
+            std::make_shared<scalar_multiplication::fixed_base_runtime_state<Curve>>(num_points, num_tables);
+    }
 };
 
 } // namespace bb
@@ -4,6 +4,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <array>
 #include <cstddef>
 #include <numeric>
 #include <string>
@@ -201,48 +202,29 @@ template <typename Curve> class IPA {
         GroupElement R_i;
         std::size_t round_size = poly_length;
 
-#ifndef NO_MULTITHREADING
-        //  The inner products we'll be computing in parallel need a mutex to be thread-safe during the last
-        //  accumulation
-        std::mutex inner_product_accumulation_mutex;
-#endif
         // Step 6.
         // Perform IPA reduction rounds
         for (size_t i = 0; i < log_poly_degree; i++) {
             round_size >>= 1;
             // Compute inner_prod_L := < a_vec_lo, b_vec_hi > and inner_prod_R := < a_vec_hi, b_vec_lo >
-            Fr inner_prod_L = Fr::zero();
-            Fr inner_prod_R = Fr::zero();
-            // Run scalar products in parallel
-            run_loop_in_parallel_if_effective(
+            // Each iteration is just two multiplications, so only spread rounds of a reasonable size across threads
+            constexpr size_t min_iterations_per_thread = 1 << 7;
+            const auto [inner_prod_L, inner_prod_R] = parallel_reduce(
                 round_size,
-                [&a_vec,
-                 &b_vec,
-                 round_size,
-                 &inner_prod_L,
-                 &inner_prod_R
-#ifndef NO_MULTITHREADING
-                 ,
-                 &inner_product_accumulation_mutex
-#endif
-            ](size_t start, size_t end) {
+                std::array<Fr, 2>{ Fr::zero(), Fr::zero() },
+                [&a_vec, &b_vec, round_size](size_t start, size_t end) {
                     Fr current_inner_prod_L = Fr::zero();
                     Fr current_inner_prod_R = Fr::zero();
                     for (size_t j = start; j < end; j++) {
                         current_inner_prod_L += a_vec[j] * b_vec[round_size + j];
                         current_inner_prod_R += a_vec[round_size + j] * b_vec[j];
                     }
-                    // Update the accumulated results thread-safely
-                    {
-#ifndef NO_MULTITHREADING
-                        std::unique_lock<std::mutex> lock(inner_product_accumulation_mutex);
-#endif
-                        inner_prod_L += current_inner_prod_L;
-                        inner_prod_R += current_inner_prod_R;
-                    }
+                    return std::array<Fr, 2>{ current_inner_prod_L, current_inner_prod_R };
+                },
+                [](const std::array<Fr, 2>& lhs, const std::array<Fr, 2>& rhs) {
+                    return std::array<Fr, 2>{ lhs[0] + rhs[0], lhs[1] + rhs[1] };
                 },
-                /*finite_field_additions_per_iteration=*/2,
-                /*finite_field_multiplications_per_iteration=*/2);
+                min_iterations_per_thread);
 
             // Step 6.a (using letters, because doxygen automaticall converts the sublist counters to letters :( )
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
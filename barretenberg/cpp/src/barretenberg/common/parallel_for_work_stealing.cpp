@@ -0,0 +1,212 @@
+#include "log.hpp"
+#include "thread.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace {
+
+/**
+ * @brief A single parallel_for invocation. Lives on the stack of the thread that called parallel_for, which does not
+ * return until every iteration has been executed.
+ */
+struct Job {
+    const std::function<void(size_t)>* func;
+    std::atomic<size_t> remaining;
+};
+
+/**
+ * @brief A contiguous range of iterations of a job. Ranges are split in half lazily by whichever thread executes them,
+ * the upper half being pushed to the executing thread's queue where it can be stolen.
+ */
+struct Task {
+    Job* job;
+    size_t begin;
+    size_t end;
+};
+
+/**
+ * @brief Per-thread double ended queue. The owner pushes and pops at the back (LIFO, good locality), thieves take from
+ * the front (FIFO, i.e. the largest ranges). Each queue has its own lock so there is no global point of contention.
+ * Padded to a cache line to avoid false sharing between neighbouring queues.
+ */
+struct alignas(64) TaskQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+class ThreadPool {
+  public:
+    ThreadPool(size_t num_threads);
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool(ThreadPool&& other) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ThreadPool& operator=(ThreadPool&& other) = delete;
+
+    void start_tasks(size_t num_iterations, const std::function<void(size_t)>& func)
+    {
+        Job job{ &func, num_iterations };
+        execute(Task{ &job, 0, num_iterations });
+        // Help out with any available work (ours, or anybody else's) until our own job is complete. This is what
+        // allows parallel_for to be nested: a worker waiting on an inner job keeps executing tasks instead of blocking.
+        while (job.remaining.load(std::memory_order_acquire) != 0) {
+            Task task{};
+            if (try_acquire(task)) {
+                execute(task);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+  private:
+    std::vector<std::thread> workers;
+    // One queue per worker, plus a final shared queue used by threads that are not part of the pool.
+    std::vector<TaskQueue> queues;
+    std::atomic<size_t> num_pending_ = 0;
+    std::atomic<size_t> num_sleeping_ = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable condition;
+    std::atomic<bool> stop = false;
+
+    BB_NO_PROFILE void worker_loop(size_t thread_index);
+
+    size_t queue_index() const;
+    void push(const Task& task);
+    bool try_acquire(Task& task);
+
+    void execute(Task task)
+    {
+        while (task.end - task.begin > 1) {
+            size_t mid = task.begin + (task.end - task.begin) / 2;
+            push(Task{ task.job, mid, task.end });
+            task.end = mid;
+        }
+        (*task.job->func)(task.begin);
+        // Must be the last access to the job, the owning thread may return as soon as this hits zero.
+        task.job->remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+};
+
+// Index of the queue owned by the current thread, if it is a worker of a pool.
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local size_t current_queue = 0;
+
+ThreadPool::ThreadPool(size_t num_threads)
+    : queues(num_threads + 1)
+{
+    workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers.emplace_back(&ThreadPool::worker_loop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::queue_index() const
+{
+    return current_pool == this ? current_queue : workers.size();
+}
+
+void ThreadPool::push(const Task& task)
+{
+    auto& queue = queues[queue_index()];
+    {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(task);
+    }
+    num_pending_.fetch_add(1);
+    // Only touch the sleep mutex if somebody may be sleeping. A worker registers as sleeping before checking
+    // num_pending_, so either it sees our increment or we see its registration.
+    if (num_sleeping_.load() != 0) {
+        { std::unique_lock<std::mutex> lock(sleep_mutex); }
+        condition.notify_one();
+    }
+}
+
+bool ThreadPool::try_acquire(Task& task)
+{
+    if (num_pending_.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    const size_t own = queue_index();
+    {
+        auto& queue = queues[own];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+            num_pending_.fetch_sub(1);
+            return true;
+        }
+    }
+    for (size_t i = 1; i < queues.size(); ++i) {
+        auto& queue = queues[(own + i) % queues.size()];
+        std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+        if (lock.owns_lock() && !queue.tasks.empty()) {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+            num_pending_.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::worker_loop(size_t thread_index)
+{
+    current_pool = this;
+    current_queue = thread_index;
+    while (true) {
+        Task task{};
+        if (try_acquire(task)) {
+            execute(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        num_sleeping_.fetch_add(1);
+        condition.wait(lock, [this] { return num_pending_.load() != 0 || stop; });
+        num_sleeping_.fetch_sub(1);
+        if (stop) {
+            break;
+        }
+    }
+}
+} // namespace
+
+namespace bb {
+/**
+ * A work-stealing strategy. Every worker owns a queue of iteration ranges. Ranges are recursively split in half, the
+ * executing thread keeps the lower half and publishes the upper half on its own queue. Idle threads steal from the
+ * opposite end of other threads' queues, so the big ranges migrate and the small ones stay local.
+ * Unlike the other pools, parallel_for can be called from within a parallel_for: the calling thread does not block,
+ * it keeps executing (or stealing) tasks until its own iterations are complete.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    static ThreadPool pool(get_num_cpus() - 1);
+
+    if (num_iterations == 0) {
+        return;
+    }
+    pool.start_tasks(num_iterations, func);
+}
+} // namespace bb
@@ -0,0 +1,72 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A small dependency graph of tasks (e.g. independent prover stages) executed on top of parallel_for.
+ *
+ * @details Tasks are added in order and may only depend on tasks added before them, so the graph is acyclic by
+ * construction. run() executes the graph in waves: every task whose dependencies are all complete is started in the
+ * same parallel_for. A task may itself call parallel_for, this relies on the default work stealing backend
+ * (parallel_for_work_stealing) which supports nesting.
+ *
+ * Example:
+ *     TaskGraph graph;
+ *     auto wires = graph.add_task([&] { commit_to_wires(); });
+ *     auto tables = graph.add_task([&] { construct_tables(); });
+ *     graph.add_task([&] { commit_to_sorted_list(); }, { wires, tables });
+ *     graph.run();
+ */
+class TaskGraph {
+  public:
+    using TaskId = size_t;
+
+    TaskId add_task(std::function<void()> func, const std::vector<TaskId>& dependencies = {})
+    {
+        const TaskId id = tasks.size();
+        size_t wave = 0;
+        for (const TaskId dependency : dependencies) {
+            ASSERT(dependency < id);
+            wave = std::max(wave, tasks[dependency].wave + 1);
+        }
+        tasks.push_back({ std::move(func), wave });
+        num_waves = std::max(num_waves, wave + 1);
+        return id;
+    }
+
+    size_t size() const { return tasks.size(); }
+
+    /**
+     * @brief Execute all tasks, respecting dependencies. Returns once every task has completed.
+     */
+    void run() const
+    {
+        std::vector<std::vector<TaskId>> waves(num_waves);
+        for (TaskId id = 0; id < tasks.size(); ++id) {
+            waves[tasks[id].wave].push_back(id);
+        }
+        for (const auto& wave : waves) {
+            if (wave.size() == 1) {
+                tasks[wave[0]].func();
+                continue;
+            }
+            parallel_for(wave.size(), [&](size_t i) { tasks[wave[i]].func(); });
+        }
+    }
+
+  private:
+    struct Node {
+        std::function<void()> func;
+        // Length of the longest dependency chain leading to this task
+        size_t wave;
+    };
+    std::vector<Node> tasks;
+    size_t num_waves = 0;
+};
+
+} // namespace bb
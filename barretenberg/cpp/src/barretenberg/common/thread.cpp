@@ -34,6 +34,12 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: Added "work_stealing", which gives each thread its own queue and lets idle threads steal. Unlike the other
+ * pools it supports nested parallel_for (a thread waiting on an inner loop keeps executing tasks), which is what
+ * TaskGraph (task_graph.hpp) needs to overlap stages that are themselves parallel. With mutex_pool a nested call
+ * clobbers the outer loop's state. Flat loops perform on par with mutex_pool (see parallel_for_bench), so we default
+ * to work_stealing.
  */
 
 namespace bb {
@@ -69,6 +75,9 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+// Per-thread deques with stealing. The only pool that supports nested parallel_for calls.
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -82,8 +91,9 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
 #endif
 #endif
 }
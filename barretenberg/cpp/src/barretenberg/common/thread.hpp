@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <atomic>
 #include <barretenberg/env/hardware_concurrency.hpp>
 #include <barretenberg/numeric/bitop/get_msb.hpp>
@@ -117,4 +118,73 @@ size_t calculate_num_threads(size_t num_iterations, size_t min_iterations_per_th
 size_t calculate_num_threads_pow2(size_t num_iterations,
                                   size_t min_iterations_per_thread = DEFAULT_MIN_ITERS_PER_THREAD);
 
+/**
+ * @brief Reduces [0, num_iterations) in parallel without locking.
+ * @details The range is split into one chunk per thread (see calculate_num_threads). `func(start, end)` returns the
+ * partial result of a chunk, which is written to its own cache line sized slot so threads never share a line. The
+ * partials are then combined in a fixed binary tree, so the result doesn't depend on scheduling. Works for anything
+ * `combine` (by default operator+) can merge: field elements, univariates, group elements, tuples of these...
+ *
+ * @param identity Returned when num_iterations is 0
+ * @param func Called as func(start, end), returns the partial result for the chunk
+ * @param combine Associative binary operation merging two partial results
+ */
+template <typename T, typename Func, typename Combine = std::plus<>>
+T parallel_reduce(size_t num_iterations,
+                  T identity,
+                  const Func& func,
+                  const Combine& combine = {},
+                  size_t min_iterations_per_thread = DEFAULT_MIN_ITERS_PER_THREAD)
+{
+    if (num_iterations == 0) {
+        return identity;
+    }
+    const size_t num_threads = calculate_num_threads(num_iterations, min_iterations_per_thread);
+    if (num_threads == 1) {
+        return func(size_t(0), num_iterations);
+    }
+    struct alignas(64) Slot {
+        T value;
+    };
+    std::vector<Slot> slots(num_threads, Slot{ identity });
+    const size_t chunk_size = (num_iterations + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * chunk_size, num_iterations);
+        const size_t end = std::min(start + chunk_size, num_iterations);
+        if (start < end) {
+            slots[thread_idx].value = func(start, end);
+        }
+    });
+    for (size_t stride = 1; stride < num_threads; stride *= 2) {
+        for (size_t i = 0; i + stride < num_threads; i += 2 * stride) {
+            slots[i].value = combine(slots[i].value, slots[i + stride].value);
+        }
+    }
+    return slots[0].value;
+}
+
+/**
+ * @brief Computes combine(transform(0), ..., transform(num_iterations - 1)) in parallel, see parallel_reduce.
+ */
+template <typename T, typename Transform, typename Combine = std::plus<>>
+T parallel_transform_reduce(size_t num_iterations,
+                            T identity,
+                            const Transform& transform,
+                            const Combine& combine = {},
+                            size_t min_iterations_per_thread = DEFAULT_MIN_ITERS_PER_THREAD)
+{
+    return parallel_reduce(
+        num_iterations,
+        identity,
+        [&](size_t start, size_t end) {
+            T result = identity;
+            for (size_t i = start; i < end; ++i) {
+                result = combine(result, transform(i));
+            }
+            return result;
+        },
+        combine,
+        min_iterations_per_thread);
+}
+
 } // namespace bb
\ No newline at end of file
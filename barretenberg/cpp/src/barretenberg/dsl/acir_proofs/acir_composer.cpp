@@ -33,11 +33,26 @@ void AcirComposer::create_circuit(acir_format::AcirFormat& constraint_system, Wi
     vinfo("circuit is recursive friendly: ", builder_.is_recursive_circuit);
 }
 
-std::shared_ptr<bb::plonk::proving_key> AcirComposer::init_proving_key()
+/**
+ * @brief Create a composer without keys, using the key cache if there is one
+ */
+acir_format::Composer AcirComposer::create_composer()
 {
     acir_format::Composer composer;
+    composer.key_cache = key_cache_;
+    composer.circuit_hash = circuit_hash_;
+    return composer;
+}
+
+std::shared_ptr<bb::plonk::proving_key> AcirComposer::init_proving_key()
+{
+    acir_format::Composer composer = create_composer();
     vinfo("computing proving key...");
     proving_key_ = composer.compute_proving_key(builder_);
+    circuit_hash_ = composer.circuit_hash;
+    if (key_cache_) {
+        vinfo("key cache hits: ", key_cache_->get_num_hits(), ", misses: ", key_cache_->get_num_misses());
+    }
     return proving_key_;
 }
 
@@ -68,7 +83,8 @@ std::shared_ptr<bb::plonk::verification_key> AcirComposer::init_verification_key
         throw_or_abort("Compute proving key first.");
     }
     vinfo("computing verification key...");
-    acir_format::Composer composer(proving_key_, nullptr);
+    acir_format::Composer composer = create_composer();
+    composer.circuit_proving_key = proving_key_;
     verification_key_ = composer.compute_verification_key(builder_);
 
     vinfo("done.");
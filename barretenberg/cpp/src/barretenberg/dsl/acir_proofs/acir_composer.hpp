@@ -1,5 +1,6 @@
 #pragma once
 #include <barretenberg/dsl/acir_format/acir_format.hpp>
+#include <barretenberg/plonk/proof_system/proving_key/proving_key_cache.hpp>
 
 namespace acir_proofs {
 
@@ -19,6 +20,11 @@ class AcirComposer {
     template <typename Builder = UltraCircuitBuilder>
     void create_circuit(acir_format::AcirFormat& constraint_system, WitnessVector const& witness = {});
 
+    /**
+     * @brief Use an on-disk cache for the proving and verification keys of the circuit
+     */
+    void set_key_cache(std::shared_ptr<bb::plonk::ProvingKeyCache> key_cache) { key_cache_ = std::move(key_cache); }
+
     std::shared_ptr<bb::plonk::proving_key> init_proving_key();
 
     std::vector<uint8_t> create_proof();
@@ -42,8 +48,12 @@ class AcirComposer {
     size_t size_hint_;
     std::shared_ptr<bb::plonk::proving_key> proving_key_;
     std::shared_ptr<bb::plonk::verification_key> verification_key_;
+    std::shared_ptr<bb::plonk::ProvingKeyCache> key_cache_;
+    std::optional<bb::plonk::ProvingKeyCache::CircuitHash> circuit_hash_;
     bool verbose_ = true;
 
+    acir_format::Composer create_composer();
+
     template <typename... Args> inline void vinfo(Args... args)
     {
         if (verbose_) {
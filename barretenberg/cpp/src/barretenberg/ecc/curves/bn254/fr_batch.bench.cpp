@@ -0,0 +1,111 @@
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/fields/field_batch.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb;
+
+/**
+ * @brief Element-wise operations over vectors of fr, one element at a time with the scalar operators (as measured for a
+ * single element by fr.bench.cpp) against the batched functions of field_batch.hpp
+ */
+namespace {
+
+struct Inputs {
+    std::vector<fr> lhs;
+    std::vector<fr> rhs;
+    std::vector<fr> result;
+
+    explicit Inputs(size_t n)
+        : lhs(n)
+        , rhs(n)
+        , result(n)
+    {
+        for (size_t i = 0; i < n; ++i) {
+            lhs[i] = fr::random_element();
+            rhs[i] = fr::random_element();
+        }
+    }
+};
+
+void mul_scalar_loop(State& state)
+{
+    Inputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < inputs.result.size(); ++i) {
+            inputs.result[i] = inputs.lhs[i] * inputs.rhs[i];
+        }
+        DoNotOptimize(inputs.result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void mul_batched(State& state)
+{
+    Inputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        mul_n<fr>(inputs.result, inputs.lhs, inputs.rhs);
+        DoNotOptimize(inputs.result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void add_scalar_loop(State& state)
+{
+    Inputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < inputs.result.size(); ++i) {
+            inputs.result[i] = inputs.lhs[i] + inputs.rhs[i];
+        }
+        DoNotOptimize(inputs.result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void add_batched(State& state)
+{
+    Inputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        add_n<fr>(inputs.result, inputs.lhs, inputs.rhs);
+        DoNotOptimize(inputs.result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// result += lhs * scalar, the operation of Polynomial::add_scaled
+void fma_scalar_loop(State& state)
+{
+    Inputs inputs(static_cast<size_t>(state.range(0)));
+    const fr scalar = fr::random_element();
+    for (auto _ : state) {
+        for (size_t i = 0; i < inputs.result.size(); ++i) {
+            inputs.result[i] += inputs.lhs[i] * scalar;
+        }
+        DoNotOptimize(inputs.result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void fma_batched(State& state)
+{
+    Inputs inputs(static_cast<size_t>(state.range(0)));
+    const fr scalar = fr::random_element();
+    for (auto _ : state) {
+        fma_n<fr>(inputs.result, inputs.lhs, scalar, inputs.result);
+        DoNotOptimize(inputs.result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(mul_scalar_loop)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(mul_batched)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(add_scalar_loop)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(add_batched)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(fma_scalar_loop)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(fma_batched)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
+// NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
+BENCHMARK_MAIN();
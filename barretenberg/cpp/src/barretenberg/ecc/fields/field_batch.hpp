@@ -0,0 +1,421 @@
+#pragma once
+#include "./field.hpp"
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+#include <immintrin.h>
+#define BB_FIELD_BATCH_IFMA 1
+#else
+#define BB_FIELD_BATCH_IFMA 0
+#endif
+
+/**
+ * @brief Batched field arithmetic over spans of elements
+ * @details The scalar field operators multiply one element at a time with MULX/ADX. On CPUs with AVX-512 IFMA
+ * (52-bit integer fused multiply-add) the functions below instead multiply 8 elements at once, one per 64-bit lane of a
+ * 512-bit register. The choice is made at runtime; everywhere else (including builds without asm and wasm) they fall
+ * back to the scalar operators, so callers need no special casing.
+ *
+ * Inputs and outputs use the same (coarse) Montgomery form as the scalar operators: results are in [0, 2p), inputs must
+ * be in [0, 2p). The outputs may therefore differ from those of the scalar operators by p, but are equal as field
+ * elements. Any of the outputs may alias an input of the same index.
+ *
+ * AVX2 has no 64-bit multiplier, and a kernel built from its 32-bit one does not beat MULX, so there is no AVX2 path.
+ */
+namespace bb {
+
+namespace field_batch_detail {
+
+/**
+ * @brief Whether the vector kernels support a field: they need a modulus p < 2^254, such that 64p fits in the 260 bits
+ * of 5 limbs of 52 bits
+ */
+template <typename Fr> constexpr bool is_ifma_field = false;
+template <typename Params>
+constexpr bool is_ifma_field<field<Params>> = Params::modulus_3 != 0 && Params::modulus_3 < 0x4000000000000000ULL;
+
+// Below this many elements the setup of the vector kernels is not worth it
+constexpr size_t MIN_VECTOR_SIZE = 8;
+
+#if BB_FIELD_BATCH_IFMA
+
+inline bool cpu_has_ifma()
+{
+    static const bool has_ifma = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return has_ifma;
+}
+
+#define BB_TARGET_IFMA __attribute__((target("avx512f,avx512ifma")))
+
+constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+
+// The unmasked shift intrinsics trip a spurious -Wmaybe-uninitialized in GCC 12, their zero-masking forms do not
+BB_TARGET_IFMA inline __m512i shift_left(__m512i x, unsigned bits)
+{
+    return _mm512_maskz_slli_epi64(0xFF, x, bits);
+}
+BB_TARGET_IFMA inline __m512i shift_right(__m512i x, unsigned bits)
+{
+    return _mm512_maskz_srli_epi64(0xFF, x, bits);
+}
+BB_TARGET_IFMA inline __m512i shift_right_signed(__m512i x, unsigned bits)
+{
+    return _mm512_maskz_srai_epi64(0xFF, x, bits);
+}
+
+/**
+ * @brief 8 field elements in radix 2^52, limb i of every element in register i
+ */
+struct Limbs52 {
+    __m512i limbs[5];
+};
+
+/**
+ * @brief 8 field elements in radix 2^64, limb i of every element in register i
+ */
+struct Limbs64 {
+    __m512i limbs[4];
+};
+
+/**
+ * @brief Load 8 consecutive field elements, transposing them such that register i holds limb i of every element
+ */
+BB_TARGET_IFMA inline Limbs64 load_transposed(const uint64_t* src)
+{
+    // Interleave pairs of registers (2 elements each) into the low two and the high two limbs of 4 elements
+    const __m512i low_limbs = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i high_limbs = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i lower_half = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i upper_half = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+
+    const __m512i v0 = _mm512_loadu_si512(src);
+    const __m512i v1 = _mm512_loadu_si512(src + 8);
+    const __m512i v2 = _mm512_loadu_si512(src + 16);
+    const __m512i v3 = _mm512_loadu_si512(src + 24);
+    const __m512i t0 = _mm512_permutex2var_epi64(v0, low_limbs, v1);
+    const __m512i t1 = _mm512_permutex2var_epi64(v0, high_limbs, v1);
+    const __m512i t2 = _mm512_permutex2var_epi64(v2, low_limbs, v3);
+    const __m512i t3 = _mm512_permutex2var_epi64(v2, high_limbs, v3);
+    return { { _mm512_permutex2var_epi64(t0, lower_half, t2),
+               _mm512_permutex2var_epi64(t0, upper_half, t2),
+               _mm512_permutex2var_epi64(t1, lower_half, t3),
+               _mm512_permutex2var_epi64(t1, upper_half, t3) } };
+}
+
+/**
+ * @brief Inverse of load_transposed
+ */
+BB_TARGET_IFMA inline void store_transposed(uint64_t* dst, const Limbs64& x)
+{
+    const __m512i low_limbs = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i high_limbs = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i lower_half = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i upper_half = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+
+    const __m512i t0 = _mm512_permutex2var_epi64(x.limbs[0], lower_half, x.limbs[1]);
+    const __m512i t2 = _mm512_permutex2var_epi64(x.limbs[0], upper_half, x.limbs[1]);
+    const __m512i t1 = _mm512_permutex2var_epi64(x.limbs[2], lower_half, x.limbs[3]);
+    const __m512i t3 = _mm512_permutex2var_epi64(x.limbs[2], upper_half, x.limbs[3]);
+    _mm512_storeu_si512(dst, _mm512_permutex2var_epi64(t0, low_limbs, t1));
+    _mm512_storeu_si512(dst + 8, _mm512_permutex2var_epi64(t0, high_limbs, t1));
+    _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi64(t2, low_limbs, t3));
+    _mm512_storeu_si512(dst + 24, _mm512_permutex2var_epi64(t2, high_limbs, t3));
+}
+
+/**
+ * @brief Convert from radix 2^64 to radix 2^52, multiplying by 2^shift on the way
+ */
+template <unsigned shift> BB_TARGET_IFMA inline Limbs52 to_radix_52(const Limbs64& x)
+{
+    static_assert(shift <= 4);
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    const __m512i* a = x.limbs;
+    const __m512i limb_1 = _mm512_or_si512(shift_right(a[0], 52 - shift), shift_left(a[1], 12 + shift));
+    const __m512i limb_2 = _mm512_or_si512(shift_right(a[1], 40 - shift), shift_left(a[2], 24 + shift));
+    const __m512i limb_3 = _mm512_or_si512(shift_right(a[2], 28 - shift), shift_left(a[3], 36 + shift));
+    return { { _mm512_and_si512(shift_left(a[0], shift), mask),
+               _mm512_and_si512(limb_1, mask),
+               _mm512_and_si512(limb_2, mask),
+               _mm512_and_si512(limb_3, mask),
+               shift_right(a[3], 16 - shift) } };
+}
+
+/**
+ * @brief Convert a normalized value (all limbs < 2^52, value < 2^256) from radix 2^52 to radix 2^64
+ */
+BB_TARGET_IFMA inline Limbs64 to_radix_64(const Limbs52& x)
+{
+    const __m512i* t = x.limbs;
+    return { { _mm512_or_si512(t[0], shift_left(t[1], 52)),
+               _mm512_or_si512(shift_right(t[1], 12), shift_left(t[2], 40)),
+               _mm512_or_si512(shift_right(t[2], 24), shift_left(t[3], 28)),
+               _mm512_or_si512(shift_right(t[3], 36), shift_left(t[4], 16)) } };
+}
+
+/**
+ * @brief Propagate carries (or, for signed limbs, borrows) such that every limb but the top one is in [0, 2^52)
+ */
+BB_TARGET_IFMA inline void normalize(Limbs52& x)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    for (size_t i = 0; i < 4; ++i) {
+        x.limbs[i + 1] = _mm512_add_epi64(x.limbs[i + 1], shift_right_signed(x.limbs[i], 52));
+        x.limbs[i] = _mm512_and_si512(x.limbs[i], mask);
+    }
+}
+
+/**
+ * @brief Limb i of 2^shift * value in radix 2^52, for value < 2^(260 - shift)
+ */
+constexpr uint64_t limb_52(const uint256_t& value, size_t i, unsigned shift = 0)
+{
+    const uint256_t limb = (i == 0) ? (value << shift) : (value >> (52 * i - shift));
+    return limb.data[0] & LIMB_MASK;
+}
+
+/**
+ * @brief Broadcast 2^shift * value to all lanes, in radix 2^52
+ */
+template <unsigned shift, typename Fr> BB_TARGET_IFMA inline Limbs52 broadcast(const Fr& value)
+{
+    const uint256_t value_256(value.data[0], value.data[1], value.data[2], value.data[3]);
+    Limbs52 result;
+    for (size_t i = 0; i < 5; ++i) {
+        result.limbs[i] = _mm512_set1_epi64(static_cast<int64_t>(limb_52(value_256, i, shift)));
+    }
+    return result;
+}
+
+template <typename Params> struct Ifma {
+    static constexpr uint256_t modulus{ Params::modulus_0, Params::modulus_1, Params::modulus_2, Params::modulus_3 };
+    static constexpr std::array<uint64_t, 5> modulus_limbs{
+        limb_52(modulus, 0), limb_52(modulus, 1), limb_52(modulus, 2), limb_52(modulus, 3), limb_52(modulus, 4)
+    };
+    static constexpr std::array<uint64_t, 5> twice_modulus_limbs{ limb_52(modulus, 0, 1),
+                                                                   limb_52(modulus, 1, 1),
+                                                                   limb_52(modulus, 2, 1),
+                                                                   limb_52(modulus, 3, 1),
+                                                                   limb_52(modulus, 4, 1) };
+    // -p^{-1} mod 2^52
+    static constexpr uint64_t r_inv = Params::r_inv & LIMB_MASK;
+
+    /**
+     * @brief a + b, reduced into [0, 2p), for a, b in [0, 2p) in normalized radix 2^52
+     */
+    BB_TARGET_IFMA static inline Limbs52 add(const Limbs52& a, const Limbs52& b)
+    {
+        Limbs52 sum;
+        Limbs52 difference;
+        for (size_t i = 0; i < 5; ++i) {
+            sum.limbs[i] = _mm512_add_epi64(a.limbs[i], b.limbs[i]);
+            difference.limbs[i] =
+                _mm512_sub_epi64(sum.limbs[i], _mm512_set1_epi64(static_cast<int64_t>(twice_modulus_limbs[i])));
+        }
+        normalize(sum);
+        normalize(difference);
+        // Keep the sum in those lanes in which subtracting 2p borrows out of the top limb
+        const __mmask8 is_negative = _mm512_cmplt_epi64_mask(difference.limbs[4], _mm512_setzero_si512());
+        for (size_t i = 0; i < 5; ++i) {
+            difference.limbs[i] = _mm512_mask_blend_epi64(is_negative, difference.limbs[i], sum.limbs[i]);
+        }
+        return difference;
+    }
+
+    /**
+     * @brief Montgomery multiplication with R = 2^260, producing a normalized result in [0, 2p)
+     * @details The field's Montgomery form has R = 2^256, so one of the operands must have been scaled by 16 for the
+     * result to be in the field's Montgomery form: (16 aR)(bR) / 2^260 = abR. For a, b < 2p the intermediate
+     * (16 a b + m p) / 2^260 is below (64 p^2 + 2^260 p) / 2^260 < 2p as p < 2^254.
+     */
+    BB_TARGET_IFMA static inline Limbs52 mul(const Limbs52& scaled_a, const Limbs52& b)
+    {
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i r_inv_vec = _mm512_set1_epi64(static_cast<int64_t>(r_inv));
+        __m512i p[5];
+        for (size_t i = 0; i < 5; ++i) {
+            p[i] = _mm512_set1_epi64(static_cast<int64_t>(modulus_limbs[i]));
+        }
+
+        // Each limb accumulates fewer than 32 terms below 2^52, so carries can be deferred until the end
+        __m512i t[6] = { zero, zero, zero, zero, zero, zero };
+        for (size_t i = 0; i < 5; ++i) {
+            for (size_t j = 0; j < 5; ++j) {
+                t[j] = _mm512_madd52lo_epu64(t[j], scaled_a.limbs[j], b.limbs[i]);
+                t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], scaled_a.limbs[j], b.limbs[i]);
+            }
+            const __m512i m = _mm512_madd52lo_epu64(zero, t[0], r_inv_vec);
+            for (size_t j = 0; j < 5; ++j) {
+                t[j] = _mm512_madd52lo_epu64(t[j], m, p[j]);
+                t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, p[j]);
+            }
+            // The low 52 bits of t[0] are now zero: shift down by one limb
+            t[0] = _mm512_add_epi64(t[1], shift_right(t[0], 52));
+            for (size_t j = 1; j < 5; ++j) {
+                t[j] = t[j + 1];
+            }
+            t[5] = zero;
+        }
+        Limbs52 result{ { t[0], t[1], t[2], t[3], t[4] } };
+        normalize(result);
+        return result;
+    }
+};
+
+template <typename Fr> BB_TARGET_IFMA inline Limbs64 load(const Fr* src)
+{
+    return load_transposed(&src->data[0]);
+}
+
+template <typename Fr> BB_TARGET_IFMA inline void store(Fr* dst, const Limbs52& x)
+{
+    store_transposed(&dst->data[0], to_radix_64(x));
+}
+
+template <typename Fr> BB_TARGET_IFMA void mul_n_ifma(Fr* result, const Fr* lhs, const Fr* rhs, size_t n)
+{
+    using Kernel = Ifma<typename Fr::Params>;
+    for (size_t i = 0; i + 8 <= n; i += 8) {
+        store(result + i, Kernel::mul(to_radix_52<4>(load(lhs + i)), to_radix_52<0>(load(rhs + i))));
+    }
+}
+
+template <typename Fr> BB_TARGET_IFMA void mul_n_ifma(Fr* result, const Fr* lhs, const Fr& rhs, size_t n)
+{
+    using Kernel = Ifma<typename Fr::Params>;
+    const Limbs52 scaled_rhs = broadcast<4>(rhs);
+    for (size_t i = 0; i + 8 <= n; i += 8) {
+        store(result + i, Kernel::mul(scaled_rhs, to_radix_52<0>(load(lhs + i))));
+    }
+}
+
+template <typename Fr> BB_TARGET_IFMA void add_n_ifma(Fr* result, const Fr* lhs, const Fr* rhs, size_t n)
+{
+    using Kernel = Ifma<typename Fr::Params>;
+    for (size_t i = 0; i + 8 <= n; i += 8) {
+        store(result + i, Kernel::add(to_radix_52<0>(load(lhs + i)), to_radix_52<0>(load(rhs + i))));
+    }
+}
+
+template <typename Fr>
+BB_TARGET_IFMA void fma_n_ifma(Fr* result, const Fr* lhs, const Fr& rhs, const Fr* addend, size_t n)
+{
+    using Kernel = Ifma<typename Fr::Params>;
+    const Limbs52 scaled_rhs = broadcast<4>(rhs);
+    for (size_t i = 0; i + 8 <= n; i += 8) {
+        const Limbs52 product = Kernel::mul(scaled_rhs, to_radix_52<0>(load(lhs + i)));
+        store(result + i, Kernel::add(product, to_radix_52<0>(load(addend + i))));
+    }
+}
+
+#undef BB_TARGET_IFMA
+
+#endif // BB_FIELD_BATCH_IFMA
+
+/**
+ * @brief The number of leading elements of a batch of size n to process with the vector kernels, or 0 if they are not
+ * available for this field and CPU
+ */
+template <typename Fr> inline size_t num_vector_elements([[maybe_unused]] size_t n)
+{
+#if BB_FIELD_BATCH_IFMA
+    if constexpr (is_ifma_field<Fr>) {
+        if (n >= MIN_VECTOR_SIZE && cpu_has_ifma()) {
+            return n & ~size_t(7);
+        }
+    }
+#endif
+    return 0;
+}
+
+} // namespace field_batch_detail
+
+/**
+ * @brief result[i] = lhs[i] * rhs[i]
+ */
+template <typename Fr>
+void mul_n(std::span<Fr> result,
+           std::span<const std::type_identity_t<Fr>> lhs,
+           std::span<const std::type_identity_t<Fr>> rhs)
+{
+    ASSERT(lhs.size() == result.size() && rhs.size() == result.size());
+    const size_t num_vector = field_batch_detail::num_vector_elements<Fr>(result.size());
+#if BB_FIELD_BATCH_IFMA
+    if constexpr (field_batch_detail::is_ifma_field<Fr>) {
+        if (num_vector > 0) {
+            field_batch_detail::mul_n_ifma(result.data(), lhs.data(), rhs.data(), num_vector);
+        }
+    }
+#endif
+    for (size_t i = num_vector; i < result.size(); ++i) {
+        result[i] = lhs[i] * rhs[i];
+    }
+}
+
+/**
+ * @brief result[i] = lhs[i] * rhs
+ */
+template <typename Fr>
+void mul_n(std::span<Fr> result, std::span<const std::type_identity_t<Fr>> lhs, const std::type_identity_t<Fr>& rhs)
+{
+    ASSERT(lhs.size() == result.size());
+    const size_t num_vector = field_batch_detail::num_vector_elements<Fr>(result.size());
+#if BB_FIELD_BATCH_IFMA
+    if constexpr (field_batch_detail::is_ifma_field<Fr>) {
+        if (num_vector > 0) {
+            field_batch_detail::mul_n_ifma(result.data(), lhs.data(), rhs, num_vector);
+        }
+    }
+#endif
+    for (size_t i = num_vector; i < result.size(); ++i) {
+        result[i] = lhs[i] * rhs;
+    }
+}
+
+/**
+ * @brief result[i] = lhs[i] + rhs[i]
+ */
+template <typename Fr>
+void add_n(std::span<Fr> result,
+           std::span<const std::type_identity_t<Fr>> lhs,
+           std::span<const std::type_identity_t<Fr>> rhs)
+{
+    ASSERT(lhs.size() == result.size() && rhs.size() == result.size());
+    const size_t num_vector = field_batch_detail::num_vector_elements<Fr>(result.size());
+#if BB_FIELD_BATCH_IFMA
+    if constexpr (field_batch_detail::is_ifma_field<Fr>) {
+        if (num_vector > 0) {
+            field_batch_detail::add_n_ifma(result.data(), lhs.data(), rhs.data(), num_vector);
+        }
+    }
+#endif
+    for (size_t i = num_vector; i < result.size(); ++i) {
+        result[i] = lhs[i] + rhs[i];
+    }
+}
+
+/**
+ * @brief result[i] = lhs[i] * rhs + addend[i]
+ */
+template <typename Fr>
+void fma_n(std::span<Fr> result,
+           std::span<const std::type_identity_t<Fr>> lhs,
+           const std::type_identity_t<Fr>& rhs,
+           std::span<const std::type_identity_t<Fr>> addend)
+{
+    ASSERT(lhs.size() == result.size() && addend.size() == result.size());
+    const size_t num_vector = field_batch_detail::num_vector_elements<Fr>(result.size());
+#if BB_FIELD_BATCH_IFMA
+    if constexpr (field_batch_detail::is_ifma_field<Fr>) {
+        if (num_vector > 0) {
+            field_batch_detail::fma_n_ifma(result.data(), lhs.data(), rhs, addend.data(), num_vector);
+        }
+    }
+#endif
+    for (size_t i = num_vector; i < result.size(); ++i) {
+        result[i] = lhs[i] * rhs + addend[i];
+    }
+}
+
+} // namespace bb
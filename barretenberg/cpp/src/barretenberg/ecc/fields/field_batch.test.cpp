@@ -0,0 +1,103 @@
+#include "barretenberg/ecc/fields/field_batch.hpp"
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+
+template <typename Field> class FieldBatchTest : public ::testing::Test {
+  public:
+    // Sizes covering the scalar path only, whole vector blocks and vector blocks followed by a scalar tail
+    static constexpr std::array<size_t, 6> sizes{ 0, 3, 8, 13, 64, 1027 };
+    // Whether the field's operators keep elements in the coarse range [0, 2p) rather than [0, p)
+    static constexpr bool is_coarse = Field::modulus.data[3] < 0x4000000000000000ULL;
+
+    static void expect_in_range(const Field& x)
+    {
+        const uint256_t bound = is_coarse ? Field::modulus + Field::modulus : Field::modulus;
+        EXPECT_LT(x.uint256_t_no_montgomery_conversion(), bound);
+    }
+
+    /**
+     * @brief Random elements, every third of which is in [p, 2p) for coarse fields
+     */
+    static std::vector<Field> random_elements(size_t n)
+    {
+        std::vector<Field> elements(n);
+        for (size_t i = 0; i < n; ++i) {
+            elements[i] = Field::random_element();
+            if (is_coarse && i % 3 == 0) {
+                const uint256_t coarse = elements[i].uint256_t_no_montgomery_conversion() + Field::modulus;
+                elements[i] = Field{ coarse.data[0], coarse.data[1], coarse.data[2], coarse.data[3] };
+            }
+        }
+        return elements;
+    }
+};
+
+using FieldTypes = ::testing::Types<fr, fq, secp256k1::fq>;
+} // namespace
+
+TYPED_TEST_SUITE(FieldBatchTest, FieldTypes);
+
+TYPED_TEST(FieldBatchTest, Mul)
+{
+    for (size_t n : TestFixture::sizes) {
+        const auto lhs = TestFixture::random_elements(n);
+        const auto rhs = TestFixture::random_elements(n);
+        std::vector<TypeParam> result(n);
+        mul_n<TypeParam>(result, lhs, rhs);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], lhs[i] * rhs[i]);
+            TestFixture::expect_in_range(result[i]);
+        }
+    }
+}
+
+TYPED_TEST(FieldBatchTest, MulScalar)
+{
+    for (size_t n : TestFixture::sizes) {
+        const auto lhs = TestFixture::random_elements(n);
+        const auto rhs = TestFixture::random_elements(1)[0];
+        std::vector<TypeParam> result(n);
+        mul_n<TypeParam>(result, lhs, rhs);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], lhs[i] * rhs);
+        }
+    }
+}
+
+TYPED_TEST(FieldBatchTest, Add)
+{
+    for (size_t n : TestFixture::sizes) {
+        const auto lhs = TestFixture::random_elements(n);
+        const auto rhs = TestFixture::random_elements(n);
+        std::vector<TypeParam> result(n);
+        add_n<TypeParam>(result, lhs, rhs);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], lhs[i] + rhs[i]);
+            TestFixture::expect_in_range(result[i]);
+        }
+    }
+}
+
+/**
+ * @brief fma_n, accumulating in place as in Polynomial::add_scaled
+ */
+TYPED_TEST(FieldBatchTest, FmaInPlace)
+{
+    for (size_t n : TestFixture::sizes) {
+        const auto lhs = TestFixture::random_elements(n);
+        const auto rhs = TestFixture::random_elements(1)[0];
+        const auto addend = TestFixture::random_elements(n);
+        auto result = addend;
+        fma_n<TypeParam>(result, lhs, rhs, result);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], lhs[i] * rhs + addend[i]);
+        }
+    }
+}
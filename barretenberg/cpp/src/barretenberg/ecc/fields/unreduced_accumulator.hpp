@@ -0,0 +1,69 @@
+#pragma once
+#include "./field.hpp"
+#include <array>
+#include <cstddef>
+
+namespace bb {
+
+/**
+ * @brief A sum of products of field elements, kept as a 576-bit integer and reduced only when it is read
+ * @details A field multiplication is a 512-bit product followed by a Montgomery reduction of similar cost. When many
+ * products are only ever summed, add_product keeps the raw 512-bit products instead and reduce performs one reduction
+ * for the whole sum.
+ *
+ * For elements in Montgomery form aR, bR the raw product is abR^2, so the sum S of the products is (Σ ab)R^2 mod p and
+ * reduce returns the Montgomery form SR^{-1} of Σ ab. A field element cR is added as cR * 2^256 = cR^2, the same scale.
+ * Products of elements in the coarse range [0, 2p) are below 2^512, so the limb above the low 512 bits counts the
+ * carries out of them and cannot overflow.
+ */
+template <typename Fr> class unreduced_accumulator {
+  public:
+    constexpr unreduced_accumulator() = default;
+    // NOLINTNEXTLINE(google-explicit-constructor) so that accumulators can be zeroed like field elements
+    constexpr unreduced_accumulator(const Fr& value)
+        : limbs{ 0, 0, 0, 0, value.data[0], value.data[1], value.data[2], value.data[3], 0 }
+    {}
+
+    /**
+     * @brief Add the product a * b, without reducing it
+     */
+    BB_INLINE void add_product(const Fr& a, const Fr& b) noexcept
+    {
+        const auto product = a.mul_512(b);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            const uint64_t sum = limbs[i] + product.data[i];
+            const uint64_t sum_carry = static_cast<uint64_t>(sum < limbs[i]);
+            limbs[i] = sum + carry;
+            carry = sum_carry + static_cast<uint64_t>(limbs[i] < carry);
+        }
+        limbs[8] += carry;
+    }
+
+    /**
+     * @brief The sum as a field element (in the coarse range of Fr)
+     * @details With S = lo + hi * 2^256 + top * 2^512, SR^{-1} = lo * R^{-1} + hi + top * R (mod p). The first term is
+     * the Montgomery product of lo with the raw integer 1, the second is hi itself and the third is the Montgomery form
+     * of top.
+     */
+    [[nodiscard]] Fr reduce() const noexcept
+    {
+        const auto reduce_integer = [](uint256_t value) {
+            while (value >= Fr::modulus) {
+                value -= Fr::modulus;
+            }
+            return Fr{ value.data[0], value.data[1], value.data[2], value.data[3] };
+        };
+        Fr result = reduce_integer(uint256_t{ limbs[0], limbs[1], limbs[2], limbs[3] }) * Fr{ 1, 0, 0, 0 };
+        result += reduce_integer(uint256_t{ limbs[4], limbs[5], limbs[6], limbs[7] });
+        if (limbs[8] != 0) {
+            result += Fr(limbs[8]);
+        }
+        return result;
+    }
+
+  private:
+    std::array<uint64_t, 9> limbs{};
+};
+
+} // namespace bb
@@ -0,0 +1,69 @@
+#include "barretenberg/ecc/fields/unreduced_accumulator.hpp"
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+
+template <typename Field> class UnreducedAccumulatorTest : public ::testing::Test {
+  public:
+    // Whether the field's operators keep elements in the coarse range [0, 2p) rather than [0, p)
+    static constexpr bool is_coarse = Field::modulus.data[3] < 0x4000000000000000ULL;
+
+    // The largest element the field's operators produce
+    static Field largest_element()
+    {
+        const uint256_t largest = is_coarse ? Field::modulus + Field::modulus - 1 : Field::modulus - 1;
+        return Field{ largest.data[0], largest.data[1], largest.data[2], largest.data[3] };
+    }
+};
+
+using FieldTypes = ::testing::Types<fr, fq, secp256k1::fq>;
+} // namespace
+
+TYPED_TEST_SUITE(UnreducedAccumulatorTest, FieldTypes);
+
+TYPED_TEST(UnreducedAccumulatorTest, SumOfProducts)
+{
+    unreduced_accumulator<TypeParam> accumulator;
+    TypeParam expected = 0;
+    for (size_t i = 0; i < 100; ++i) {
+        const auto a = TypeParam::random_element();
+        const auto b = TypeParam::random_element();
+        accumulator.add_product(a, b);
+        expected += a * b;
+    }
+    EXPECT_EQ(accumulator.reduce(), expected);
+}
+
+TYPED_TEST(UnreducedAccumulatorTest, InitialValue)
+{
+    const auto initial = TypeParam::random_element();
+    unreduced_accumulator<TypeParam> accumulator(initial);
+    EXPECT_EQ(accumulator.reduce(), initial);
+
+    const auto a = TypeParam::random_element();
+    const auto b = TypeParam::random_element();
+    accumulator.add_product(a, b);
+    EXPECT_EQ(accumulator.reduce(), initial + a * b);
+
+    EXPECT_EQ(unreduced_accumulator<TypeParam>(0).reduce(), TypeParam(0));
+}
+
+/**
+ * @brief Products of the largest elements, whose sum carries out of the low 512 bits
+ */
+TYPED_TEST(UnreducedAccumulatorTest, CarriesOutOf512Bits)
+{
+    const auto largest = TestFixture::largest_element();
+    unreduced_accumulator<TypeParam> accumulator;
+    TypeParam expected = 0;
+    for (size_t i = 0; i < 1000; ++i) {
+        accumulator.add_product(largest, largest);
+        expected += largest * largest;
+    }
+    EXPECT_EQ(accumulator.reduce(), expected);
+}
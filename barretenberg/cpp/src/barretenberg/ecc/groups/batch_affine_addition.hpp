@@ -0,0 +1,269 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_batch.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace bb::group_elements {
+
+// Included by element_impl.hpp, itself included by affine_element.hpp
+template <typename Fq_, typename Fr_, typename Params> class affine_element;
+
+/**
+ * @brief Independent affine point additions and doublings that share their field inversions
+ *
+ * @details An affine addition (x1, y1) + (x2, y2) costs one inversion of x2 - x1, two multiplications and a squaring.
+ * Montgomery's trick replaces the inversions of a sequence of additions by a single one at the cost of three
+ * multiplications per addition, for six multiplications per addition in total (against eleven for a mixed Jacobian
+ * addition), provided that no addition in the sequence depends on the output of another.
+ *
+ * The additions are processed in chunks of CHUNK_SIZE, with one inversion per chunk, so that a chunk of inputs and its
+ * scratch space stay in L2 between the passes. Within a chunk only the recovery of the individual inverses is a serial
+ * chain: the slopes, their squares and the y-coordinates are computed over contiguous arrays with the batched field
+ * operations of field_batch.hpp.
+ *
+ * The inputs are only read, and no output is written before all the inputs of its chunk have been read. An output
+ * may therefore alias the inputs of its own addition or, as in Pippenger's bucket accumulation, those of an addition
+ * with a larger index: chunks are processed from the last to the first.
+ */
+template <typename Fq, typename Fr, typename Params> class batch_affine_addition {
+  public:
+    using affine_element = group_elements::affine_element<Fq, Fr, Params>;
+
+    // Large enough to amortise the ~400 multiplications of an inversion, small enough for a chunk of inputs and its
+    // scratch space (~600KB) to stay in L2
+    static constexpr size_t CHUNK_SIZE = 2048;
+
+    enum class PairType : uint8_t { ADD, DOUBLE, LHS_ONLY, RHS_ONLY, OPPOSITE };
+
+    struct Scratch {
+        std::array<Fq, CHUNK_SIZE> prefix_products;
+        std::array<Fq, CHUNK_SIZE> denominators;
+        std::array<Fq, CHUNK_SIZE> numerators;
+        std::array<Fq, CHUNK_SIZE> x_sums;
+        std::array<PairType, CHUNK_SIZE> pair_types;
+    };
+
+    /**
+     * @brief out[i] = lhs[i * stride] + rhs[i * stride] for i < num_pairs
+     *
+     * @details Without edge case handling the points of each pair must have distinct x-coordinates and not be at
+     * infinity. With it, a pair may contain the point at infinity, equal points (doubled) or opposite points (summed to
+     * infinity).
+     */
+    template <bool handle_edge_cases = false>
+    static void add(const affine_element* lhs,
+                    const affine_element* rhs,
+                    size_t stride,
+                    affine_element* out,
+                    size_t num_pairs,
+                    Scratch& scratch)
+    {
+        size_t chunk_end = num_pairs;
+        while (chunk_end > 0) {
+            const size_t chunk_start = chunk_end - std::min(chunk_end, CHUNK_SIZE);
+            add_chunk<handle_edge_cases>(lhs + chunk_start * stride,
+                                         rhs + chunk_start * stride,
+                                         stride,
+                                         out + chunk_start,
+                                         chunk_end - chunk_start,
+                                         scratch);
+            chunk_end = chunk_start;
+        }
+    }
+
+    /**
+     * @brief out[i] = lhs[i] + rhs[i], in parallel. out may alias lhs or rhs
+     */
+    template <bool handle_edge_cases = false>
+    static void add(std::span<const affine_element> lhs,
+                    std::span<const affine_element> rhs,
+                    std::span<affine_element> out)
+    {
+        ASSERT(lhs.size() == rhs.size() && out.size() == lhs.size());
+        run_loop_in_parallel_if_effective(
+            lhs.size(),
+            [&](size_t start, size_t end) {
+                auto scratch = std::make_unique<Scratch>();
+                add<handle_edge_cases>(&lhs[start], &rhs[start], 1, &out[start], end - start, *scratch);
+            },
+            /*finite_field_additions_per_iteration=*/6,
+            /*finite_field_multiplications_per_iteration=*/6);
+    }
+
+    /**
+     * @brief points[i] = 2 * points[i] for i < num_points. The points must not be at infinity or of order 2
+     */
+    static void dbl(affine_element* points, size_t num_points, Scratch& scratch)
+    {
+        for (size_t chunk_start = 0; chunk_start < num_points; chunk_start += CHUNK_SIZE) {
+            dbl_chunk(points + chunk_start, std::min(num_points - chunk_start, CHUNK_SIZE), scratch);
+        }
+    }
+
+    /**
+     * @brief points[i] = 2 * points[i], in parallel
+     */
+    static void dbl(std::span<affine_element> points)
+    {
+        run_loop_in_parallel_if_effective(
+            points.size(),
+            [&](size_t start, size_t end) {
+                auto scratch = std::make_unique<Scratch>();
+                dbl(&points[start], end - start, *scratch);
+            },
+            /*finite_field_additions_per_iteration=*/7,
+            /*finite_field_multiplications_per_iteration=*/7);
+    }
+
+  private:
+    static PairType classify(const affine_element& lhs, const affine_element& rhs)
+    {
+        if (lhs.is_point_at_infinity()) {
+            return PairType::RHS_ONLY;
+        }
+        if (rhs.is_point_at_infinity()) {
+            return PairType::LHS_ONLY;
+        }
+        if (lhs.x == rhs.x) {
+            return lhs.y == rhs.y ? PairType::DOUBLE : PairType::OPPOSITE;
+        }
+        return PairType::ADD;
+    }
+
+    /**
+     * @brief Replace denominators[i] by its inverse for i < n, where prefix_products[i] is the product of the
+     * denominators before i and accumulator the product of all of them
+     */
+    static void invert_denominators(Scratch& scratch, size_t n, Fq accumulator)
+    {
+        if (accumulator.is_zero()) {
+            throw_or_abort("attempted to invert zero in batch affine addition");
+        }
+        accumulator = accumulator.invert();
+        for (size_t i = n - 1; i < n; --i) {
+            const Fq inverse = accumulator * scratch.prefix_products[i];
+            accumulator *= scratch.denominators[i];
+            scratch.denominators[i] = inverse;
+        }
+    }
+
+    /**
+     * @brief From the slopes λ in numerators and x1 + x2 in x_sums, compute x3 = λ² - (x1 + x2) in x_sums and
+     * λ(x1 - x3) in numerators
+     */
+    static void compute_sums(Scratch& scratch, size_t n, const affine_element* lhs, size_t stride)
+    {
+        const std::span<Fq> lambdas(scratch.numerators.data(), n);
+        const std::span<Fq> products(scratch.denominators.data(), n);
+        mul_n<Fq>(products, lambdas, lambdas);
+        for (size_t i = 0; i < n; ++i) {
+            scratch.x_sums[i] = products[i] - scratch.x_sums[i];
+            products[i] = lhs[i * stride].x - scratch.x_sums[i];
+        }
+        mul_n<Fq>(lambdas, lambdas, products);
+    }
+
+    template <bool handle_edge_cases>
+    static void add_chunk(const affine_element* lhs,
+                          const affine_element* rhs,
+                          size_t stride,
+                          affine_element* out,
+                          size_t n,
+                          Scratch& scratch)
+    {
+        // Gather the numerators and denominators of the slopes and x1 + x2, with the prefix products of the
+        // denominators
+        Fq accumulator = Fq::one();
+        for (size_t i = 0; i < n; ++i) {
+            const affine_element& p1 = lhs[i * stride];
+            const affine_element& p2 = rhs[i * stride];
+            const PairType type = handle_edge_cases ? classify(p1, p2) : PairType::ADD;
+            scratch.pair_types[i] = type;
+            scratch.prefix_products[i] = accumulator;
+            if (type == PairType::ADD) {
+                scratch.denominators[i] = p2.x - p1.x;
+                scratch.numerators[i] = p2.y - p1.y;
+                scratch.x_sums[i] = p1.x + p2.x;
+            } else if (type == PairType::DOUBLE) {
+                // λ = (3x² + a) / 2y
+                const Fq x_squared = p1.x.sqr();
+                scratch.denominators[i] = p1.y + p1.y;
+                scratch.numerators[i] = x_squared + x_squared + x_squared;
+                if constexpr (Params::has_a) {
+                    scratch.numerators[i] += Params::a;
+                }
+                scratch.x_sums[i] = p1.x + p1.x;
+            } else {
+                scratch.denominators[i] = Fq::one();
+                scratch.numerators[i] = Fq::zero();
+                scratch.x_sums[i] = Fq::zero();
+            }
+            accumulator *= scratch.denominators[i];
+        }
+
+        invert_denominators(scratch, n, accumulator);
+        const std::span<Fq> numerators(scratch.numerators.data(), n);
+        mul_n<Fq>(numerators, numerators, std::span<const Fq>(scratch.denominators.data(), n));
+        compute_sums(scratch, n, lhs, stride);
+
+        // From the last pair to the first, as out[i] may alias the inputs of pairs after i
+        for (size_t i = n - 1; i < n; --i) {
+            const affine_element& p1 = lhs[i * stride];
+            switch (scratch.pair_types[i]) {
+            case PairType::LHS_ONLY:
+                out[i] = p1;
+                break;
+            case PairType::RHS_ONLY:
+                out[i] = rhs[i * stride];
+                break;
+            case PairType::OPPOSITE:
+                out[i].self_set_infinity();
+                break;
+            default:
+                out[i].y = scratch.numerators[i] - p1.y;
+                out[i].x = scratch.x_sums[i];
+            }
+        }
+    }
+
+    static void dbl_chunk(affine_element* points, size_t n, Scratch& scratch)
+    {
+        Fq accumulator = Fq::one();
+        for (size_t i = 0; i < n; ++i) {
+            scratch.prefix_products[i] = accumulator;
+            scratch.denominators[i] = points[i].y + points[i].y;
+            scratch.x_sums[i] = points[i].x;
+            accumulator *= scratch.denominators[i];
+        }
+
+        // λ = (3x² + a) / 2y
+        const std::span<Fq> numerators(scratch.numerators.data(), n);
+        const std::span<const Fq> xs(scratch.x_sums.data(), n);
+        mul_n<Fq>(numerators, xs, xs);
+        for (size_t i = 0; i < n; ++i) {
+            const Fq x_squared = numerators[i];
+            numerators[i] = x_squared + x_squared + x_squared;
+            if constexpr (Params::has_a) {
+                numerators[i] += Params::a;
+            }
+            scratch.x_sums[i] += scratch.x_sums[i];
+        }
+        invert_denominators(scratch, n, accumulator);
+        mul_n<Fq>(numerators, numerators, std::span<const Fq>(scratch.denominators.data(), n));
+        compute_sums(scratch, n, points, 1);
+
+        for (size_t i = 0; i < n; ++i) {
+            points[i].y = scratch.numerators[i] - points[i].y;
+            points[i].x = scratch.x_sums[i];
+        }
+    }
+};
+
+} // namespace bb::group_elements
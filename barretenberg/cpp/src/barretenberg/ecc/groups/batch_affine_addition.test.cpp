@@ -0,0 +1,114 @@
+#include "barretenberg/ecc/groups/batch_affine_addition.hpp"
+#include "barretenberg/ecc/curves/bn254/g1.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/curves/secp256r1/secp256r1.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+template <typename G1> class BatchAffineAdditionTest : public testing::Test {
+  public:
+    using element = typename G1::element;
+    using affine_element = typename G1::affine_element;
+    using batch_affine_addition = typename G1::batch_affine_addition;
+
+    // Several chunks followed by a partial one
+    static constexpr size_t num_pairs = 2 * batch_affine_addition::CHUNK_SIZE + 37;
+
+    static std::vector<affine_element> random_points(size_t n)
+    {
+        std::vector<affine_element> points(n);
+        for (auto& point : points) {
+            point = affine_element(element::random_element());
+        }
+        return points;
+    }
+};
+
+// secp256r1 covers curves with a non-zero a
+using Groups = testing::Types<g1, grumpkin::g1, secp256r1::g1>;
+} // namespace
+
+TYPED_TEST_SUITE(BatchAffineAdditionTest, Groups);
+
+TYPED_TEST(BatchAffineAdditionTest, Add)
+{
+    using affine_element = typename TestFixture::affine_element;
+    using element = typename TestFixture::element;
+    const auto lhs = TestFixture::random_points(TestFixture::num_pairs);
+    const auto rhs = TestFixture::random_points(TestFixture::num_pairs);
+    std::vector<affine_element> out(TestFixture::num_pairs);
+
+    TestFixture::batch_affine_addition::add(lhs, rhs, out);
+    for (size_t i = 0; i < TestFixture::num_pairs; ++i) {
+        EXPECT_EQ(out[i], affine_element(element(lhs[i]) + element(rhs[i])));
+    }
+
+    // In place, as IPA and batch_mul_with_endomorphism use it
+    auto in_place = rhs;
+    TestFixture::batch_affine_addition::add(lhs, in_place, in_place);
+    EXPECT_EQ(in_place, out);
+}
+
+/**
+ * @brief The layout of Pippenger's bucket accumulation: points[i] + points[i + 1] is written to points[(i + n) / 2]
+ */
+TYPED_TEST(BatchAffineAdditionTest, AddAdjacentPairsInPlace)
+{
+    using affine_element = typename TestFixture::affine_element;
+    using element = typename TestFixture::element;
+    constexpr size_t num_pairs = TestFixture::num_pairs;
+    auto points = TestFixture::random_points(2 * num_pairs);
+    const auto expected_points = points;
+
+    auto scratch = std::make_unique<typename TestFixture::batch_affine_addition::Scratch>();
+    TestFixture::batch_affine_addition::add(
+        points.data(), points.data() + 1, 2, points.data() + num_pairs, num_pairs, *scratch);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        const auto expected = affine_element(element(expected_points[2 * i]) + element(expected_points[2 * i + 1]));
+        EXPECT_EQ(points[num_pairs + i], expected);
+    }
+}
+
+TYPED_TEST(BatchAffineAdditionTest, AddWithEdgeCases)
+{
+    using affine_element = typename TestFixture::affine_element;
+    using element = typename TestFixture::element;
+    auto lhs = TestFixture::random_points(TestFixture::num_pairs);
+    auto rhs = TestFixture::random_points(TestFixture::num_pairs);
+    for (size_t i = 0; i < TestFixture::num_pairs; i += 5) {
+        rhs[i] = lhs[i];
+        if (i + 1 < TestFixture::num_pairs) {
+            rhs[i + 1] = -lhs[i + 1];
+        }
+        if (i + 2 < TestFixture::num_pairs) {
+            lhs[i + 2].self_set_infinity();
+        }
+        if (i + 3 < TestFixture::num_pairs) {
+            rhs[i + 3].self_set_infinity();
+        }
+    }
+    std::vector<affine_element> out(TestFixture::num_pairs);
+
+    TestFixture::batch_affine_addition::template add</*handle_edge_cases=*/true>(lhs, rhs, out);
+    for (size_t i = 0; i < TestFixture::num_pairs; ++i) {
+        EXPECT_EQ(out[i], affine_element(element(lhs[i]) + element(rhs[i])));
+    }
+}
+
+TYPED_TEST(BatchAffineAdditionTest, Double)
+{
+    using affine_element = typename TestFixture::affine_element;
+    using element = typename TestFixture::element;
+    const auto points = TestFixture::random_points(TestFixture::num_pairs);
+
+    auto doubled = points;
+    TestFixture::batch_affine_addition::dbl(doubled);
+    for (size_t i = 0; i < TestFixture::num_pairs; ++i) {
+        EXPECT_EQ(doubled[i], affine_element(element(points[i]).dbl()));
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/batch_affine_addition.hpp"
 #include "barretenberg/ecc/groups/element.hpp"
 #include "element.hpp"
 #include <cstdint>
@@ -718,75 +719,8 @@ void element<Fq, Fr, T>::batch_affine_add(const std::span<affine_element<Fq, Fr,
                                           const std::span<affine_element<Fq, Fr, T>>& second_group,
                                           const std::span<affine_element<Fq, Fr, T>>& results) noexcept
 {
-    typedef affine_element<Fq, Fr, T> affine_element;
-    const size_t num_points = first_group.size();
-    ASSERT(second_group.size() == first_group.size());
-
-    // Space for temporary values
-    std::vector<Fq> scratch_space(num_points);
-
-    run_loop_in_parallel_if_effective(
-        num_points,
-        [&results, &first_group](size_t start, size_t end) {
-            for (size_t i = start; i < end; i++) {
-                results[i] = first_group[i];
-            }
-        },
-        /*finite_field_additions_per_iteration=*/0,
-        /*finite_field_multiplications_per_iteration=*/0,
-        /*finite_field_inversions_per_iteration=*/0,
-        /*group_element_additions_per_iteration=*/0,
-        /*group_element_doublings_per_iteration=*/0,
-        /*scalar_multiplications_per_iteration=*/0,
-        /*sequential_copy_ops_per_iteration=*/2);
-
-    // TODO(#826): Same code as in batch mul
-    //  we can mutate rhs but NOT lhs!
-    //  output is stored in rhs
-    /**
-     * @brief Perform point addition rhs[i]=rhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_add_chunked =
-        [](const affine_element* lhs, affine_element* rhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-                personal_scratch_space[i] = lhs[i].x + rhs[i].x; // x2 + x1
-                rhs[i].x -= lhs[i].x;                            // x2 - x1
-                rhs[i].y -= lhs[i].y;                            // y2 - y1
-                rhs[i].y *= batch_inversion_accumulator;         // (y2 - y1)*accumulator_old
-                batch_inversion_accumulator *= (rhs[i].x);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-                rhs[i].y *= batch_inversion_accumulator; // update accumulator
-                batch_inversion_accumulator *= rhs[i].x;
-                rhs[i].x = rhs[i].y.sqr();
-                rhs[i].x = rhs[i].x - (personal_scratch_space[i]); // x3 = lambda_squared - x2
-                                                                   // - x1
-                personal_scratch_space[i] = lhs[i].x - rhs[i].x;
-                personal_scratch_space[i] *= rhs[i].y;
-                rhs[i].y = personal_scratch_space[i] - lhs[i].y;
-            }
-        };
-
-    /**
-     * @brief Perform batch affine addition in parallel
-     *
-     */
-    const auto batch_affine_add_internal =
-        [num_points, &scratch_space, &batch_affine_add_chunked](const affine_element* lhs, affine_element* rhs) {
-            run_loop_in_parallel_if_effective(
-                num_points,
-                [lhs, &rhs, &scratch_space, &batch_affine_add_chunked](size_t start, size_t end) {
-                    batch_affine_add_chunked(lhs + start, rhs + start, end - start, &scratch_space[0] + start);
-                },
-                /*finite_field_additions_per_iteration=*/6,
-                /*finite_field_multiplications_per_iteration=*/6);
-        };
-    batch_affine_add_internal(&second_group[0], &results[0]);
+    ASSERT(second_group.size() == first_group.size() && results.size() >= first_group.size());
+    batch_affine_addition<Fq, Fr, T>::add(first_group, second_group, results.subspan(0, first_group.size()));
 }
 
 /**
@@ -807,99 +741,12 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
     typedef affine_element<Fq, Fr, T> affine_element;
     const size_t num_points = points.size();
 
-    // Space for temporary values
-    std::vector<Fq> scratch_space(num_points);
-
-    // TODO(#826): Same code as in batch add
-    //  we can mutate rhs but NOT lhs!
-    //  output is stored in rhs
-    /**
-     * @brief Perform point addition rhs[i]=rhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_add_chunked =
-        [](const affine_element* lhs, affine_element* rhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-                personal_scratch_space[i] = lhs[i].x + rhs[i].x; // x2 + x1
-                rhs[i].x -= lhs[i].x;                            // x2 - x1
-                rhs[i].y -= lhs[i].y;                            // y2 - y1
-                rhs[i].y *= batch_inversion_accumulator;         // (y2 - y1)*accumulator_old
-                batch_inversion_accumulator *= (rhs[i].x);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-                rhs[i].y *= batch_inversion_accumulator; // update accumulator
-                batch_inversion_accumulator *= rhs[i].x;
-                rhs[i].x = rhs[i].y.sqr();
-                rhs[i].x = rhs[i].x - (personal_scratch_space[i]); // x3 = lambda_squared - x2
-                                                                   // - x1
-                personal_scratch_space[i] = lhs[i].x - rhs[i].x;
-                personal_scratch_space[i] *= rhs[i].y;
-                rhs[i].y = personal_scratch_space[i] - lhs[i].y;
-            }
-        };
-
-    /**
-     * @brief Perform batch affine addition in parallel
-     *
-     */
-    const auto batch_affine_add_internal =
-        [num_points, &scratch_space, &batch_affine_add_chunked](const affine_element* lhs, affine_element* rhs) {
-            run_loop_in_parallel_if_effective(
-                num_points,
-                [lhs, &rhs, &scratch_space, &batch_affine_add_chunked](size_t start, size_t end) {
-                    batch_affine_add_chunked(lhs + start, rhs + start, end - start, &scratch_space[0] + start);
-                },
-                /*finite_field_additions_per_iteration=*/6,
-                /*finite_field_multiplications_per_iteration=*/6);
-        };
-
-    /**
-     * @brief Perform point doubling lhs[i]=lhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_double_chunked =
-        [](affine_element* lhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-
-                personal_scratch_space[i] = lhs[i].x.sqr();
-                personal_scratch_space[i] =
-                    personal_scratch_space[i] + personal_scratch_space[i] + personal_scratch_space[i];
-
-                personal_scratch_space[i] *= batch_inversion_accumulator;
-
-                batch_inversion_accumulator *= (lhs[i].y + lhs[i].y);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            Fq temp;
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-
-                personal_scratch_space[i] *= batch_inversion_accumulator;
-                batch_inversion_accumulator *= (lhs[i].y + lhs[i].y);
-
-                temp = lhs[i].x;
-                lhs[i].x = personal_scratch_space[i].sqr() - (lhs[i].x + lhs[i].x);
-                lhs[i].y = personal_scratch_space[i] * (temp - lhs[i].x) - lhs[i].y;
-            }
-        };
-    /**
-     * @brief Perform point doubling in parallel
-     *
-     */
-    const auto batch_affine_double = [num_points, &scratch_space, &batch_affine_double_chunked](affine_element* lhs) {
-        run_loop_in_parallel_if_effective(
-            num_points,
-            [&lhs, &scratch_space, &batch_affine_double_chunked](size_t start, size_t end) {
-                batch_affine_double_chunked(lhs + start, end - start, &scratch_space[0] + start);
-            },
-            /*finite_field_additions_per_iteration=*/7,
-            /*finite_field_multiplications_per_iteration=*/6);
+    using batch_affine_addition = group_elements::batch_affine_addition<Fq, Fr, T>;
+    const auto batch_affine_add_internal = [num_points](const affine_element* lhs, affine_element* rhs) {
+        batch_affine_addition::add({ lhs, num_points }, { rhs, num_points }, { rhs, num_points });
+    };
+    const auto batch_affine_double = [num_points](affine_element* lhs) {
+        batch_affine_addition::dbl({ lhs, num_points });
     };
 
     // We compute the resulting point through WNAF by evaluating (the (\sum_i (16ⁱ⋅
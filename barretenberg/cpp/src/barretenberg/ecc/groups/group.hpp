@@ -2,6 +2,7 @@
 
 #include "../../common/assert.hpp"
 #include "./affine_element.hpp"
+#include "./batch_affine_addition.hpp"
 #include "./element.hpp"
 #include "./wnaf.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
@@ -33,6 +34,7 @@ template <typename _coordinate_field, typename _subgroup_field, typename GroupPa
     using subgroup_field = _subgroup_field;
     using element = group_elements::element<coordinate_field, subgroup_field, GroupParams>;
     using affine_element = group_elements::affine_element<coordinate_field, subgroup_field, GroupParams>;
+    using batch_affine_addition = group_elements::batch_affine_addition<coordinate_field, subgroup_field, GroupParams>;
     using Fq = coordinate_field;
     using Fr = subgroup_field;
     static constexpr bool USE_ENDOMORPHISM = GroupParams::USE_ENDOMORPHISM;
@@ -0,0 +1,277 @@
+#include "./fixed_base.hpp"
+#include "./process_buckets.hpp"
+#include "./scalar_multiplication.hpp"
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/wnaf.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+namespace bb::scalar_multiplication {
+
+namespace {
+constexpr size_t get_num_fixed_base_rounds(const size_t bits_per_bucket, const size_t num_tables)
+{
+    const size_t num_rounds = WNAF_SIZE(bits_per_bucket + 1);
+    return (num_rounds + num_tables - 1) / num_tables;
+}
+
+/**
+ * Rough count of group operations performed by a pippenger-style msm: every point is added into a bucket once per wnaf
+ * round, and every (possibly merged) round concatenates its buckets.
+ **/
+constexpr size_t estimate_msm_cost(const size_t num_points,
+                                   const size_t num_wnaf_rounds,
+                                   const size_t num_rounds,
+                                   const size_t bits_per_bucket)
+{
+    return (num_wnaf_rounds * num_points) + (num_rounds << (bits_per_bucket + 1));
+}
+} // namespace
+
+template <typename Curve> size_t fixed_base_point_table<Curve>::get_table_shift() const
+{
+    return get_num_fixed_base_rounds(bits_per_bucket, num_tables) * (bits_per_bucket + 1);
+}
+
+template <typename Curve> size_t fixed_base_point_table<Curve>::get_num_rounds() const
+{
+    return get_num_fixed_base_rounds(bits_per_bucket, num_tables);
+}
+
+template <typename Curve>
+fixed_base_runtime_state<Curve>::fixed_base_runtime_state(const size_t num_points, const size_t num_tables) noexcept
+    : pippenger_state(num_points * num_tables)
+    , wnaf_table_ptr(get_mem_slab((WNAF_SIZE(get_fixed_base_bucket_width(num_points, num_tables) + 1) * num_points * 2 +
+                                   pippenger_state.prefetch_overflow) *
+                                  sizeof(uint64_t)))
+    , wnaf_table(reinterpret_cast<uint64_t*>(wnaf_table_ptr.get()))
+{}
+
+/**
+ * Computes `num_tables` pippenger point tables from `pippenger_points` (itself the output of
+ * generate_pippenger_point_table). Table `k` is table 0 scaled by 2^{k * table_shift}.
+ * `tables` must have space for `num_tables * 2 * num_points` points, the first table may alias `pippenger_points`.
+ **/
+template <typename Curve>
+void generate_fixed_base_point_table(const typename Curve::AffineElement* pippenger_points,
+                                     typename Curve::AffineElement* tables,
+                                     const size_t num_points,
+                                     const size_t num_tables,
+                                     const size_t bits_per_bucket)
+{
+    using Element = typename Curve::Element;
+    using Fq = typename Curve::BaseField;
+
+    const size_t table_shift = get_num_fixed_base_rounds(bits_per_bucket, num_tables) * (bits_per_bucket + 1);
+    const size_t table_size = num_points * 2;
+    const Fq beta = Fq::cube_root_of_unity();
+
+    if (tables != pippenger_points) {
+        memcpy(static_cast<void*>(tables), static_cast<const void*>(pippenger_points), table_size * sizeof(*tables));
+    }
+
+    const size_t num_threads = get_num_cpus();
+    const size_t points_per_thread = (num_points + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * points_per_thread;
+        const size_t end = std::min(start + points_per_thread, num_points);
+        if (start >= end) {
+            return;
+        }
+        std::vector<Element> accumulators(end - start);
+        std::vector<Element> normalized(end - start);
+        for (size_t i = start; i < end; ++i) {
+            accumulators[i - start] = Element(pippenger_points[i * 2]);
+        }
+        for (size_t k = 1; k < num_tables; ++k) {
+            for (auto& accumulator : accumulators) {
+                for (size_t j = 0; j < table_shift; ++j) {
+                    accumulator.self_dbl();
+                }
+            }
+            normalized = accumulators;
+            Element::batch_normalize(&normalized[0], normalized.size());
+            auto* table = tables + (k * table_size);
+            for (size_t i = start; i < end; ++i) {
+                const auto& point = normalized[i - start];
+                table[i * 2] = { point.x, point.y };
+                table[i * 2 + 1] = { beta * point.x, -point.y };
+            }
+        }
+    });
+}
+
+template <typename Curve>
+fixed_base_point_table<Curve> compute_fixed_base_point_table(const typename Curve::AffineElement* pippenger_points,
+                                                             const size_t num_points,
+                                                             const size_t num_tables)
+{
+    using AffineElement = typename Curve::AffineElement;
+    ASSERT(num_tables > 0);
+
+    fixed_base_point_table<Curve> result;
+    result.num_points = num_points;
+    result.num_tables = num_tables;
+    result.bits_per_bucket = get_fixed_base_bucket_width(num_points, num_tables);
+    result.points = std::static_pointer_cast<AffineElement[]>(get_mem_slab(result.size_in_bytes()));
+    generate_fixed_base_point_table<Curve>(
+        pippenger_points, result.points.get(), num_points, num_tables, result.bits_per_bucket);
+    return result;
+}
+
+/**
+ * Multi-scalar multiplication against the first `num_initial_points` points of a fixed-base table.
+ * Like pippenger_unsafe, assumes the incomplete addition formula exceptions are not triggered.
+ *
+ * 1. compute the wnaf schedule of every scalar, using the bucket width of the table
+ * 2. merge each group of rounds that map onto the same round of a shifted table, remapping the point indices
+ * 3. sort and evaluate the merged rounds with the regular pippenger machinery
+ *
+ * Falls back to regular pippenger on the first table if the msm is too small to benefit from the table's bucket
+ * width.
+ **/
+template <typename Curve>
+typename Curve::Element fixed_base_pippenger_unsafe(typename Curve::ScalarField* scalars,
+                                                    const fixed_base_point_table<Curve>& table,
+                                                    const size_t num_initial_points,
+                                                    fixed_base_runtime_state<Curve>& state)
+{
+    BB_OP_COUNT_TIME();
+    using Fr = typename Curve::ScalarField;
+    ASSERT(num_initial_points <= table.num_points);
+
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_tables = table.num_tables;
+    const size_t bits_per_bucket = table.bits_per_bucket;
+    const size_t wnaf_bits = bits_per_bucket + 1;
+    const size_t num_wnaf_rounds = WNAF_SIZE(wnaf_bits);
+    const size_t num_rounds = table.get_num_rounds();
+
+    const size_t default_num_rounds = get_num_rounds(num_points);
+    const size_t default_cost =
+        estimate_msm_cost(num_points, default_num_rounds, default_num_rounds, get_optimal_bucket_width(num_initial_points));
+    const size_t fixed_base_cost = estimate_msm_cost(num_points, num_wnaf_rounds, num_rounds, bits_per_bucket);
+    if (num_initial_points <= get_num_cpus_pow2() * 8 || default_cost <= fixed_base_cost) {
+        return pippenger_unsafe<Curve>(scalars, table.points.get(), num_initial_points, state.pippenger_state);
+    }
+
+    auto& pippenger_state = state.pippenger_state;
+    const size_t num_threads = get_num_cpus_pow2();
+    const size_t points_per_thread = num_initial_points / num_threads;
+    std::vector<std::array<uint64_t, pippenger_runtime_state<Curve>::MAX_NUM_ROUNDS>> thread_round_counts(num_threads);
+
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        auto& round_counts = thread_round_counts[thread_idx];
+        std::fill(round_counts.begin(), round_counts.end(), 0);
+        const size_t start = thread_idx * points_per_thread;
+        const size_t end = (thread_idx == num_threads - 1) ? num_initial_points : start + points_per_thread;
+        Fr T0;
+        for (size_t i = start; i < end; ++i) {
+            T0 = scalars[i].from_montgomery_form();
+            Fr::split_into_endomorphism_scalars(T0, T0, *(Fr*)&T0.data[2]);
+            wnaf::fixed_wnaf_with_counts(&T0.data[0],
+                                         &state.wnaf_table[i * 2],
+                                         pippenger_state.skew_table[i * 2],
+                                         &round_counts[0],
+                                         static_cast<uint64_t>(i * 2) << 32ULL,
+                                         num_points,
+                                         wnaf_bits);
+            wnaf::fixed_wnaf_with_counts(&T0.data[2],
+                                         &state.wnaf_table[i * 2 + 1],
+                                         pippenger_state.skew_table[i * 2 + 1],
+                                         &round_counts[0],
+                                         static_cast<uint64_t>(i * 2 + 1) << 32ULL,
+                                         num_points,
+                                         wnaf_bits);
+        }
+    });
+
+    // wnaf round `i` has weight 2^{(num_wnaf_rounds - 1 - i) * wnaf_bits}. Round `i` is merged into round
+    // `round_index` using the points of table `table_index`.
+    const auto get_table_index = [&](size_t i) { return (num_wnaf_rounds - 1 - i) / num_rounds; };
+    const auto get_round_index = [&](size_t i) { return num_rounds - 1 - ((num_wnaf_rounds - 1 - i) % num_rounds); };
+
+    std::vector<uint64_t> wnaf_round_counts(num_wnaf_rounds, 0);
+    std::vector<uint64_t> wnaf_round_offsets(num_wnaf_rounds, 0);
+    for (size_t i = 0; i < num_rounds; ++i) {
+        pippenger_state.round_counts[i] = 0;
+    }
+    // Iterate from the least significant round so that table 0 entries come first within a merged round
+    for (size_t i = num_wnaf_rounds - 1; i < num_wnaf_rounds; --i) {
+        for (size_t j = 0; j < num_threads; ++j) {
+            wnaf_round_counts[i] += thread_round_counts[j][i];
+        }
+        const size_t round_index = get_round_index(i);
+        wnaf_round_offsets[i] = pippenger_state.round_counts[round_index];
+        pippenger_state.round_counts[round_index] += wnaf_round_counts[i];
+    }
+
+    const size_t round_stride = num_points * num_tables;
+    parallel_for(num_wnaf_rounds, [&](size_t i) {
+        const uint64_t point_offset = static_cast<uint64_t>(get_table_index(i) * table.num_points * 2) << 32ULL;
+        const uint64_t* source = &state.wnaf_table[i * num_points];
+        uint64_t* destination =
+            &pippenger_state.point_schedule[get_round_index(i) * round_stride + wnaf_round_offsets[i]];
+        size_t count = 0;
+        for (size_t j = 0; j < num_points; ++j) {
+            const uint64_t entry = source[j];
+            if (entry != 0xffffffffffffffffULL) {
+                destination[count++] = entry + point_offset;
+            }
+        }
+        ASSERT(count == wnaf_round_counts[i]);
+    });
+
+    parallel_for(num_rounds, [&](size_t i) {
+        process_buckets(&pippenger_state.point_schedule[i * round_stride],
+                        pippenger_state.round_counts[i],
+                        static_cast<uint32_t>(wnaf_bits));
+    });
+
+    return evaluate_pippenger_rounds<Curve>(
+        pippenger_state, table.points.get(), num_points, round_stride, num_rounds, bits_per_bucket, false);
+}
+
+template struct fixed_base_point_table<curve::BN254>;
+template struct fixed_base_point_table<curve::Grumpkin>;
+template struct fixed_base_runtime_state<curve::BN254>;
+template struct fixed_base_runtime_state<curve::Grumpkin>;
+
+template void generate_fixed_base_point_table<curve::BN254>(const curve::BN254::AffineElement* pippenger_points,
+                                                            curve::BN254::AffineElement* tables,
+                                                            const size_t num_points,
+                                                            const size_t num_tables,
+                                                            const size_t bits_per_bucket);
+template void generate_fixed_base_point_table<curve::Grumpkin>(const curve::Grumpkin::AffineElement* pippenger_points,
+                                                               curve::Grumpkin::AffineElement* tables,
+                                                               const size_t num_points,
+                                                               const size_t num_tables,
+                                                               const size_t bits_per_bucket);
+
+template fixed_base_point_table<curve::BN254> compute_fixed_base_point_table<curve::BN254>(
+    const curve::BN254::AffineElement* pippenger_points, const size_t num_points, const size_t num_tables);
+template fixed_base_point_table<curve::Grumpkin> compute_fixed_base_point_table<curve::Grumpkin>(
+    const curve::Grumpkin::AffineElement* pippenger_points, const size_t num_points, const size_t num_tables);
+
+template curve::BN254::Element fixed_base_pippenger_unsafe<curve::BN254>(
+    curve::BN254::ScalarField* scalars,
+    const fixed_base_point_table<curve::BN254>& table,
+    const size_t num_initial_points,
+    fixed_base_runtime_state<curve::BN254>& state);
+template curve::Grumpkin::Element fixed_base_pippenger_unsafe<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const fixed_base_point_table<curve::Grumpkin>& table,
+    const size_t num_initial_points,
+    fixed_base_runtime_state<curve::Grumpkin>& state);
+
+} // namespace bb::scalar_multiplication
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "./runtime_states.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * Fixed-base multi-scalar multiplication.
+ *
+ * When the same set of base points (e.g. the SRS) is used for many multi-scalar multiplications, we can trade memory
+ * for speed by precomputing shifted copies of the points. We store `num_tables` pippenger point tables (each of size
+ * `2 * num_points`, see `generate_pippenger_point_table`) where table `k` contains the points multiplied by
+ * 2^{k * table_shift}.
+ *
+ * Pippenger splits each (endomorphism-split, 127-bit) scalar into R windows of `bits_per_bucket + 1` bits. Window `p`
+ * (counting from the least significant) has weight 2^{p * w}. Writing p = k * c + v, with c = ceil(R / num_tables) and
+ * table_shift = c * w, the window can be added into the buckets of round `v` using the point from table `k`. This
+ * leaves us with c rounds of `num_tables` times as many points, i.e. a factor of `num_tables` fewer bucket
+ * concatenations and doublings. More importantly, because each round now sees `num_tables * 2 * n` points, it pays to
+ * use a larger bucket width, which reduces R and hence the number of bucket additions.
+ *
+ * The bucket width is fixed when the table is generated (the table shift depends on it).
+ **/
+template <typename Curve> struct fixed_base_point_table {
+    using AffineElement = typename Curve::AffineElement;
+
+    // The number of base points. Every table has 2 * num_points entries (the points and their endomorphisms).
+    size_t num_points = 0;
+    size_t num_tables = 0;
+    size_t bits_per_bucket = 0;
+    // num_tables consecutive pippenger point tables. May be backed by a memory mapped file.
+    std::shared_ptr<AffineElement[]> points;
+
+    size_t get_table_shift() const;
+    size_t get_num_rounds() const;
+    size_t size_in_bytes() const { return num_tables * 2 * num_points * sizeof(AffineElement); }
+};
+
+/**
+ * Bucket width used by a fixed-base table. Every round sees `num_tables` times as many points as regular pippenger.
+ **/
+constexpr size_t get_fixed_base_bucket_width(const size_t num_points, const size_t num_tables)
+{
+    return get_optimal_bucket_width(num_points * num_tables);
+}
+
+template <typename Curve> struct fixed_base_runtime_state {
+    // Sized for num_tables * num_points points. Holds the reorganised point schedule, buckets and skew table.
+    pippenger_runtime_state<Curve> pippenger_state;
+    // The schedule as produced by the wnaf computation, before rounds are combined.
+    std::shared_ptr<void> wnaf_table_ptr;
+    uint64_t* wnaf_table;
+
+    fixed_base_runtime_state(size_t num_points, size_t num_tables) noexcept;
+};
+
+template <typename Curve>
+void generate_fixed_base_point_table(const typename Curve::AffineElement* pippenger_points,
+                                     typename Curve::AffineElement* tables,
+                                     size_t num_points,
+                                     size_t num_tables,
+                                     size_t bits_per_bucket);
+
+template <typename Curve>
+fixed_base_point_table<Curve> compute_fixed_base_point_table(const typename Curve::AffineElement* pippenger_points,
+                                                             size_t num_points,
+                                                             size_t num_tables);
+
+template <typename Curve>
+typename Curve::Element fixed_base_pippenger_unsafe(typename Curve::ScalarField* scalars,
+                                                    const fixed_base_point_table<Curve>& table,
+                                                    size_t num_initial_points,
+                                                    fixed_base_runtime_state<Curve>& state);
+
+} // namespace bb::scalar_multiplication
@@ -29,18 +29,17 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
           get_mem_slab((static_cast<size_t>(num_points) * 2 + (num_threads * 16)) * sizeof(AffineElement)))
     , point_pairs_2_ptr(
           get_mem_slab((static_cast<size_t>(num_points) * 2 + (num_threads * 16)) * sizeof(AffineElement)))
-    , scratch_space_ptr(get_mem_slab(static_cast<size_t>(num_points) * sizeof(AffineElement)))
+    , scratch_space_ptr(get_mem_slab(num_threads * sizeof(batch_affine_scratch<Curve>)))
     , point_schedule(reinterpret_cast<uint64_t*>(point_schedule_ptr.get()))
     , point_pairs_1(reinterpret_cast<AffineElement*>(point_pairs_1_ptr.get()))
     , point_pairs_2(reinterpret_cast<AffineElement*>(point_pairs_2_ptr.get()))
-    , scratch_space(reinterpret_cast<Fq*>(scratch_space_ptr.get()))
+    , scratch_space(reinterpret_cast<batch_affine_scratch<Curve>*>(scratch_space_ptr.get()))
     , skew_table(reinterpret_cast<bool*>(aligned_alloc(64, pad(static_cast<size_t>(num_points) * sizeof(bool), 64))))
     , bucket_counts(reinterpret_cast<uint32_t*>(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t))))
     , bit_counts(reinterpret_cast<uint32_t*>(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t))))
     , bucket_empty_status(reinterpret_cast<bool*>(aligned_alloc(64, num_threads * num_buckets * sizeof(bool))))
     , round_counts(reinterpret_cast<uint64_t*>(aligned_alloc(32, MAX_NUM_ROUNDS * sizeof(uint64_t))))
 {
-    using Fq = typename Curve::BaseField;
     using AffineElement = typename Curve::AffineElement;
 
     const auto num_points_floor = static_cast<size_t>(1ULL << (numeric::get_msb(num_points)));
@@ -58,7 +57,6 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
         memset(reinterpret_cast<void*>(point_pairs_2 + thread_offset + (i * 16)),
                0,
                (points_per_thread + 16) * sizeof(AffineElement));
-        memset(reinterpret_cast<void*>(scratch_space + thread_offset), 0, (points_per_thread) * sizeof(Fq));
         for (size_t j = 0; j < num_rounds; ++j) {
             const size_t round_offset = (j * static_cast<size_t>(num_points));
             memset(reinterpret_cast<void*>(point_schedule + round_offset + thread_offset),
@@ -172,7 +170,7 @@ affine_product_runtime_state<Curve> pippenger_runtime_state<Curve>::get_affine_p
 
     product_state.point_pairs_1 = point_pairs_1 + (thread_index * points_per_thread) + (thread_index * 16);
     product_state.point_pairs_2 = point_pairs_2 + (thread_index * points_per_thread) + (thread_index * 16);
-    product_state.scratch_space = scratch_space + (thread_index * (points_per_thread / 2));
+    product_state.scratch_space = scratch_space + thread_index;
     product_state.bucket_counts = bucket_counts + (thread_index * (num_buckets));
     product_state.bit_offsets = bit_counts + (thread_index * (num_buckets));
     product_state.bucket_empty_status = bucket_empty_status + (thread_index * (num_buckets));
@@ -63,11 +63,14 @@ constexpr size_t get_num_rounds(const size_t num_points)
     return WNAF_SIZE(bits_per_bucket + 1);
 }
 
+// Scratch space of the batched affine additions of the bucket accumulation
+template <typename Curve> using batch_affine_scratch = typename Curve::Group::batch_affine_addition::Scratch;
+
 template <typename Curve> struct affine_product_runtime_state {
     typename Curve::AffineElement* points;
     typename Curve::AffineElement* point_pairs_1;
     typename Curve::AffineElement* point_pairs_2;
-    typename Curve::BaseField* scratch_space;
+    batch_affine_scratch<Curve>* scratch_space;
     uint32_t* bucket_counts;
     uint32_t* bit_offsets;
     uint64_t* point_schedule;
@@ -93,7 +96,8 @@ template <typename Curve> struct pippenger_runtime_state {
     uint64_t* point_schedule;
     typename Curve::AffineElement* point_pairs_1;
     typename Curve::AffineElement* point_pairs_2;
-    typename Curve::BaseField* scratch_space;
+    // One per thread
+    batch_affine_scratch<Curve>* scratch_space;
 
     bool* skew_table;
     uint32_t* bucket_counts;
@@ -3,11 +3,13 @@
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <vector>
 
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
@@ -310,109 +312,22 @@ void organize_buckets(uint64_t* point_schedule, const size_t num_points)
 template <typename Curve>
 void add_affine_points(typename Curve::AffineElement* points,
                        const size_t num_points,
-                       typename Curve::BaseField* scratch_space)
+                       batch_affine_scratch<Curve>* scratch_space)
 {
-    using Fq = typename Curve::BaseField;
-    Fq batch_inversion_accumulator = Fq::one();
-
-    for (size_t i = 0; i < num_points; i += 2) {
-        scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
-        points[i + 1].x -= points[i].x;                        // x2 - x1
-        points[i + 1].y -= points[i].y;                        // y2 - y1
-        points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
-        batch_inversion_accumulator *= (points[i + 1].x);
-    }
-
-    if (batch_inversion_accumulator == 0) {
-        throw_or_abort("attempted to invert zero in add_affine_points");
-    } else {
-        batch_inversion_accumulator = batch_inversion_accumulator.invert();
-    }
-
-    for (size_t i = (num_points)-2; i < num_points; i -= 2) {
-        // Memory bandwidth is a bit of a bottleneck here.
-        // There's probably a more elegant way of structuring our data so we don't need to do all of this
-        // prefetching
-        __builtin_prefetch(points + i - 2);
-        __builtin_prefetch(points + i - 1);
-        __builtin_prefetch(points + ((i + num_points - 2) >> 1));
-        __builtin_prefetch(scratch_space + ((i - 2) >> 1));
-
-        points[i + 1].y *= batch_inversion_accumulator; // update accumulator
-        batch_inversion_accumulator *= points[i + 1].x;
-        points[i + 1].x = points[i + 1].y.sqr();
-        points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
-                                                                                     // - x1
-        points[i].x -= points[(i + num_points) >> 1].x;
-        points[i].x *= points[i + 1].y;
-        points[(i + num_points) >> 1].y = points[i].x - points[i].y;
-    }
+    // points[i] + points[i + 1] is written to points[(i + num_points) / 2], which only overwrites inputs of pairs that
+    // come after i: the engine processes pairs in decreasing order, so these have already been consumed
+    const size_t num_pairs = num_points >> 1;
+    Curve::Group::batch_affine_addition::add(points, points + 1, 2, points + num_pairs, num_pairs, *scratch_space);
 }
 
 template <typename Curve>
 void add_affine_points_with_edge_cases(typename Curve::AffineElement* points,
                                        const size_t num_points,
-                                       typename Curve::BaseField* scratch_space)
+                                       batch_affine_scratch<Curve>* scratch_space)
 {
-    using Fq = typename Curve::BaseField;
-    Fq batch_inversion_accumulator = Fq::one();
-
-    for (size_t i = 0; i < num_points; i += 2) {
-        if (points[i].is_point_at_infinity() || points[i + 1].is_point_at_infinity()) {
-            continue;
-        }
-        if (points[i].x == points[i + 1].x) {
-            if (points[i].y == points[i + 1].y) {
-                // double
-                scratch_space[i >> 1] = points[i].x + points[i].x; // 2x
-                Fq x_squared = points[i].x.sqr();
-                points[i + 1].x = points[i].y + points[i].y;         // 2y
-                points[i + 1].y = x_squared + x_squared + x_squared; // 3x^2
-                points[i + 1].y *= batch_inversion_accumulator;
-                batch_inversion_accumulator *= (points[i + 1].x);
-                continue;
-            }
-            points[i].self_set_infinity();
-            points[i + 1].self_set_infinity();
-            continue;
-        }
-
-        scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
-        points[i + 1].x -= points[i].x;                        // x2 - x1
-        points[i + 1].y -= points[i].y;                        // y2 - y1
-        points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
-        batch_inversion_accumulator *= (points[i + 1].x);
-    }
-    if (!batch_inversion_accumulator.is_zero()) {
-        batch_inversion_accumulator = batch_inversion_accumulator.invert();
-    }
-    for (size_t i = (num_points)-2; i < num_points; i -= 2) {
-        // Memory bandwidth is a bit of a bottleneck here.
-        // There's probably a more elegant way of structuring our data so we don't need to do all of this
-        // prefetching
-        __builtin_prefetch(points + i - 2);
-        __builtin_prefetch(points + i - 1);
-        __builtin_prefetch(points + ((i + num_points - 2) >> 1));
-        __builtin_prefetch(scratch_space + ((i - 2) >> 1));
-
-        if (points[i].is_point_at_infinity()) {
-            points[(i + num_points) >> 1] = points[i + 1];
-            continue;
-        }
-        if (points[i + 1].is_point_at_infinity()) {
-            points[(i + num_points) >> 1] = points[i];
-            continue;
-        }
-
-        points[i + 1].y *= batch_inversion_accumulator; // update accumulator
-        batch_inversion_accumulator *= points[i + 1].x;
-        points[i + 1].x = points[i + 1].y.sqr();
-        points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
-                                                                                     // - x1
-        points[i].x -= points[(i + num_points) >> 1].x;
-        points[i].x *= points[i + 1].y;
-        points[(i + num_points) >> 1].y = points[i].x - points[i].y;
-    }
+    const size_t num_pairs = num_points >> 1;
+    Curve::Group::batch_affine_addition::template add</*handle_edge_cases=*/true>(
+        points, points + 1, 2, points + num_pairs, num_pairs, *scratch_space);
 }
 
 /**
@@ -743,12 +658,34 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
                                                   typename Curve::AffineElement* points,
                                                   const size_t num_points,
                                                   bool handle_edge_cases)
+{
+    return evaluate_pippenger_rounds<Curve>(state,
+                                            points,
+                                            num_points,
+                                            num_points,
+                                            get_num_rounds(num_points),
+                                            get_optimal_bucket_width(num_points / 2),
+                                            handle_edge_cases);
+}
+
+/**
+ * Evaluates `num_rounds` pippenger rounds. The sorted schedule of round `i` starts at
+ * `state.point_schedule[i * round_stride]` and contains `state.round_counts[i]` entries. Point indices in the schedule
+ * refer to `points`, which may be larger than `num_points` (see fixed_base.hpp). The skew correction subtracts the
+ * first `num_points` entries of `points`.
+ **/
+template <typename Curve>
+typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>& state,
+                                                  typename Curve::AffineElement* points,
+                                                  const size_t num_points,
+                                                  const size_t round_stride,
+                                                  const size_t num_rounds,
+                                                  const size_t bits_per_bucket,
+                                                  bool handle_edge_cases)
 {
     using Element = typename Curve::Element;
     using AffineElement = typename Curve::AffineElement;
-    const size_t num_rounds = get_num_rounds(num_points);
     const size_t num_threads = get_num_cpus_pow2();
-    const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
 
     std::unique_ptr<Element[], decltype(&aligned_free)> thread_accumulators(
         static_cast<Element*>(aligned_alloc(64, num_threads * sizeof(Element))), &aligned_free);
@@ -771,7 +708,7 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
                     (j == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
 
                 uint64_t* thread_point_schedule =
-                    &state.point_schedule[(i * num_points) + j * num_round_points_per_thread];
+                    &state.point_schedule[(i * round_stride) + j * num_round_points_per_thread];
                 const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
                 const size_t last_bucket =
                     thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
@@ -827,10 +764,12 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
 
             if (i == (num_rounds - 1)) {
                 const size_t num_points_per_thread = num_points / num_threads;
+                const size_t num_thread_points =
+                    (j == num_threads - 1) ? num_points - (num_points_per_thread * j) : num_points_per_thread;
                 bool* skew_table = &state.skew_table[j * num_points_per_thread];
                 AffineElement* point_table = &points[j * num_points_per_thread];
                 AffineElement addition_temporary;
-                for (size_t k = 0; k < num_points_per_thread; ++k) {
+                for (size_t k = 0; k < num_thread_points; ++k) {
                     if (skew_table[k]) {
                         addition_temporary = -point_table[k];
                         accumulator += addition_temporary;
@@ -946,6 +885,109 @@ typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
     return pippenger(scalars, points, num_initial_points, state, false);
 }
 
+/**
+ * Computes one MSM per entry of `scalars` against (a prefix of) the same pippenger point table, writing them to
+ * `results`.
+ *
+ * Every MSM is split into power of two slices like `pippenger` does and the slices of the whole batch are pipelined
+ * over the two runtime states: while the rounds of one slice are evaluated in one state, the wnaf decomposition and
+ * bucket sort of the next slice run concurrently in the other. The sort is only parallel over the rounds, so on its
+ * own it leaves most cores idle; overlapping it with the bucket accumulation of the previous slice keeps them busy
+ * through the whole batch, and no memory is allocated per MSM. Slices below the pippenger threshold are computed with
+ * plain scalar multiplications at the end.
+ *
+ * It's unsafe in the same way as `pippenger_unsafe`.
+ **/
+template <typename Curve>
+void pippenger_batch_unsafe(std::span<const std::span<const typename Curve::ScalarField>> scalars,
+                            typename Curve::AffineElement* points,
+                            pippenger_runtime_state<Curve>& state,
+                            pippenger_runtime_state<Curve>& next_state,
+                            std::span<typename Curve::Element> results)
+{
+    using Element = typename Curve::Element;
+    struct Slice {
+        size_t msm;
+        size_t offset;
+        size_t num_points;
+    };
+    ASSERT(results.size() == scalars.size());
+    const size_t threshold = get_num_cpus_pow2() * 8;
+
+    std::vector<Slice> slices;
+    std::vector<Slice> small_slices;
+    size_t num_small_points = 0;
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        results[i].self_set_infinity();
+        size_t offset = 0;
+        size_t remaining = scalars[i].size();
+        while (remaining > threshold) {
+            const auto slice_size = static_cast<size_t>(1ULL << numeric::get_msb(static_cast<uint64_t>(remaining)));
+            slices.push_back({ i, offset, slice_size });
+            offset += slice_size;
+            remaining -= slice_size;
+        }
+        if (remaining > 0) {
+            small_slices.push_back({ i, offset, remaining });
+            num_small_points += remaining;
+        }
+    }
+
+    const auto prepare = [&](const Slice& slice, pippenger_runtime_state<Curve>& slice_state) {
+        compute_wnaf_states<Curve>(slice_state.point_schedule,
+                                   slice_state.skew_table,
+                                   slice_state.round_counts,
+                                   &scalars[slice.msm][slice.offset],
+                                   slice.num_points);
+        organize_buckets(slice_state.point_schedule, slice.num_points * 2);
+    };
+    const auto evaluate = [&](const Slice& slice, pippenger_runtime_state<Curve>& slice_state) {
+        results[slice.msm] +=
+            evaluate_pippenger_rounds<Curve>(slice_state, &points[slice.offset * 2], slice.num_points * 2, false);
+    };
+
+    std::array<pippenger_runtime_state<Curve>*, 2> states{ &state, &next_state };
+    if (!slices.empty()) {
+        prepare(slices[0], *states[0]);
+    }
+    for (size_t i = 0; i < slices.size(); ++i) {
+        auto& current_state = *states[i & 1];
+        if (i + 1 == slices.size()) {
+            evaluate(slices[i], current_state);
+            break;
+        }
+        auto& upcoming_state = *states[(i + 1) & 1];
+        parallel_for(2, [&](size_t task) {
+            if (task == 0) {
+                evaluate(slices[i], current_state);
+            } else {
+                prepare(slices[i + 1], upcoming_state);
+            }
+        });
+    }
+
+    if (num_small_points == 0) {
+        return;
+    }
+    std::vector<Element> products(num_small_points);
+    std::vector<size_t> product_offsets(small_slices.size() + 1, 0);
+    for (size_t i = 0; i < small_slices.size(); ++i) {
+        product_offsets[i + 1] = product_offsets[i] + small_slices[i].num_points;
+    }
+    parallel_for(small_slices.size(), [&](size_t i) {
+        const Slice& slice = small_slices[i];
+        for (size_t j = 0; j < slice.num_points; ++j) {
+            products[product_offsets[i] + j] =
+                Element(points[(slice.offset + j) * 2]) * scalars[slice.msm][slice.offset + j];
+        }
+    });
+    for (size_t i = 0; i < small_slices.size(); ++i) {
+        for (size_t j = product_offsets[i]; j < product_offsets[i + 1]; ++j) {
+            results[small_slices[i].msm] += products[j];
+        }
+    }
+}
+
 template <typename Curve>
 typename Curve::Element pippenger_without_endomorphism_basis_points(typename Curve::ScalarField* scalars,
                                                                     typename Curve::AffineElement* points,
@@ -968,11 +1010,11 @@ template uint32_t construct_addition_chains<curve::BN254>(affine_product_runtime
 
 template void add_affine_points<curve::BN254>(curve::BN254::AffineElement* points,
                                               const size_t num_points,
-                                              curve::BN254::BaseField* scratch_space);
+                                              batch_affine_scratch<curve::BN254>* scratch_space);
 
 template void add_affine_points_with_edge_cases<curve::BN254>(curve::BN254::AffineElement* points,
                                                               const size_t num_points,
-                                                              curve::BN254::BaseField* scratch_space);
+                                                              batch_affine_scratch<curve::BN254>* scratch_space);
 
 template void evaluate_addition_chains<curve::BN254>(affine_product_runtime_state<curve::BN254>& state,
                                                      const size_t max_bucket_bits,
@@ -988,6 +1030,14 @@ template curve::BN254::Element evaluate_pippenger_rounds<curve::BN254>(pippenger
                                                                        const size_t num_points,
                                                                        bool handle_edge_cases = false);
 
+template curve::BN254::Element evaluate_pippenger_rounds<curve::BN254>(pippenger_runtime_state<curve::BN254>& state,
+                                                                       curve::BN254::AffineElement* points,
+                                                                       const size_t num_points,
+                                                                       const size_t round_stride,
+                                                                       const size_t num_rounds,
+                                                                       const size_t bits_per_bucket,
+                                                                       bool handle_edge_cases);
+
 template curve::BN254::AffineElement* reduce_buckets<curve::BN254>(affine_product_runtime_state<curve::BN254>& state,
                                                                    bool first_round = true,
                                                                    bool handle_edge_cases = false);
@@ -1003,6 +1053,13 @@ template curve::BN254::Element pippenger_unsafe<curve::BN254>(curve::BN254::Scal
                                                               const size_t num_initial_points,
                                                               pippenger_runtime_state<curve::BN254>& state);
 
+template void pippenger_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars,
+    curve::BN254::AffineElement* points,
+    pippenger_runtime_state<curve::BN254>& state,
+    pippenger_runtime_state<curve::BN254>& next_state,
+    std::span<curve::BN254::Element> results);
+
 template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve::BN254>(
     curve::BN254::ScalarField* scalars,
     curve::BN254::AffineElement* points,
@@ -1019,11 +1076,11 @@ template uint32_t construct_addition_chains<curve::Grumpkin>(affine_product_runt
 
 template void add_affine_points<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                  const size_t num_points,
-                                                 curve::Grumpkin::BaseField* scratch_space);
+                                                 batch_affine_scratch<curve::Grumpkin>* scratch_space);
 
 template void add_affine_points_with_edge_cases<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                                  const size_t num_points,
-                                                                 curve::Grumpkin::BaseField* scratch_space);
+                                                                 batch_affine_scratch<curve::Grumpkin>* scratch_space);
 
 template void evaluate_addition_chains<curve::Grumpkin>(affine_product_runtime_state<curve::Grumpkin>& state,
                                                         const size_t max_bucket_bits,
@@ -1040,6 +1097,15 @@ template curve::Grumpkin::Element evaluate_pippenger_rounds<curve::Grumpkin>(
     const size_t num_points,
     bool handle_edge_cases = false);
 
+template curve::Grumpkin::Element evaluate_pippenger_rounds<curve::Grumpkin>(
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_points,
+    const size_t round_stride,
+    const size_t num_rounds,
+    const size_t bits_per_bucket,
+    bool handle_edge_cases);
+
 template curve::Grumpkin::AffineElement* reduce_buckets<curve::Grumpkin>(
     affine_product_runtime_state<curve::Grumpkin>& state, bool first_round = true, bool handle_edge_cases = false);
 
@@ -1054,6 +1120,13 @@ template curve::Grumpkin::Element pippenger_unsafe<curve::Grumpkin>(curve::Grump
                                                                     const size_t num_initial_points,
                                                                     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template void pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    curve::Grumpkin::AffineElement* points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    pippenger_runtime_state<curve::Grumpkin>& next_state,
+    std::span<curve::Grumpkin::Element> results);
+
 template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<curve::Grumpkin>(
     curve::Grumpkin::ScalarField* scalars,
     curve::Grumpkin::AffineElement* points,
@@ -5,6 +5,7 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace bb::scalar_multiplication {
 
@@ -122,12 +123,12 @@ uint32_t construct_addition_chains(affine_product_runtime_state<Curve>& state, b
 template <typename Curve>
 void add_affine_points(typename Curve::AffineElement* points,
                        size_t num_points,
-                       typename Curve::BaseField* scratch_space);
+                       batch_affine_scratch<Curve>* scratch_space);
 
 template <typename Curve>
 void add_affine_points_with_edge_cases(typename Curve::AffineElement* points,
                                        size_t num_points,
-                                       typename Curve::BaseField* scratch_space);
+                                       batch_affine_scratch<Curve>* scratch_space);
 
 template <typename Curve>
 void evaluate_addition_chains(affine_product_runtime_state<Curve>& state,
@@ -146,6 +147,15 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
                                                   size_t num_points,
                                                   bool handle_edge_cases = false);
 
+template <typename Curve>
+typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>& state,
+                                                  typename Curve::AffineElement* points,
+                                                  size_t num_points,
+                                                  size_t round_stride,
+                                                  size_t num_rounds,
+                                                  size_t bits_per_bucket,
+                                                  bool handle_edge_cases);
+
 template <typename Curve>
 typename Curve::AffineElement* reduce_buckets(affine_product_runtime_state<Curve>& state,
                                               bool first_round = true,
@@ -164,6 +174,13 @@ typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
                                          size_t num_initial_points,
                                          pippenger_runtime_state<Curve>& state);
 
+template <typename Curve>
+void pippenger_batch_unsafe(std::span<const std::span<const typename Curve::ScalarField>> scalars,
+                            typename Curve::AffineElement* points,
+                            pippenger_runtime_state<Curve>& state,
+                            pippenger_runtime_state<Curve>& next_state,
+                            std::span<typename Curve::Element> results);
+
 template <typename Curve>
 typename Curve::Element pippenger_without_endomorphism_basis_points(typename Curve::ScalarField* scalars,
                                                                     typename Curve::AffineElement* points,
@@ -115,6 +115,11 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
     // instances
     size_t pub_inputs_offset = 0;
 
+    // Ranges [start, end) of rows outside of which every relation vanishes identically: the blocks of the execution
+    // trace, the lookup tables and the rows holding lagrange polynomials. Empty if not known, e.g. for accumulated
+    // instances, meaning that every row is active.
+    std::vector<std::pair<size_t, size_t>> active_row_ranges;
+
     // The number of public inputs has to be the same for all instances because they are
     // folded element by element.
     std::vector<FF> public_inputs;
@@ -174,8 +179,9 @@ class VerificationKey_ : public PrecomputedCommitments {
         this->num_public_inputs = proving_key->num_public_inputs;
         this->pub_inputs_offset = proving_key->pub_inputs_offset;
 
+        // Selectors and lagrange polynomials are mostly zeros and small values
         for (auto [polynomial, commitment] : zip_view(proving_key->get_precomputed_polynomials(), this->get_all())) {
-            commitment = proving_key->commitment_key->commit(polynomial);
+            commitment = proving_key->commitment_key->commit_sparse(polynomial);
         }
     }
 };
@@ -271,6 +277,41 @@ template <typename Tuple, std::size_t Index = 0> static constexpr auto create_su
     }
 }
 
+/**
+ * @brief Same as create_protogalaxy_tuple_of_tuples_of_univariates, with UnreducedUnivariates for the relations that
+ * support them.
+ */
+template <typename Tuple, size_t NUM_INSTANCES, size_t Index = 0>
+static constexpr auto create_protogalaxy_tuple_of_tuples_of_unreduced_univariates()
+{
+    if constexpr (Index >= std::tuple_size<Tuple>::value) {
+        return std::tuple<>{}; // Return empty when reach end of the tuple
+    } else {
+        using UnivariateTuple = typename std::tuple_element_t<Index, Tuple>::
+            template ProtogalaxyTupleOfUnreducedUnivariatesOverSubrelations<NUM_INSTANCES>;
+        return std::tuple_cat(
+            std::tuple<UnivariateTuple>{},
+            create_protogalaxy_tuple_of_tuples_of_unreduced_univariates<Tuple, NUM_INSTANCES, Index + 1>());
+    }
+}
+
+/**
+ * @brief Same as create_sumcheck_tuple_of_tuples_of_univariates, with UnreducedUnivariates for the relations that
+ * support them.
+ */
+template <typename Tuple, std::size_t Index = 0>
+static constexpr auto create_sumcheck_tuple_of_tuples_of_unreduced_univariates()
+{
+    if constexpr (Index >= std::tuple_size<Tuple>::value) {
+        return std::tuple<>{}; // Return empty when reach end of the tuple
+    } else {
+        using UnivariateTuple =
+            typename std::tuple_element_t<Index, Tuple>::SumcheckTupleOfUnreducedUnivariatesOverSubrelations;
+        return std::tuple_cat(std::tuple<UnivariateTuple>{},
+                              create_sumcheck_tuple_of_tuples_of_unreduced_univariates<Tuple, Index + 1>());
+    }
+}
+
 /**
  * @brief Recursive utility function to construct tuple of arrays
  * @details Container for storing value of each identity in each relation. Each Relation contributes an array of
@@ -161,18 +161,42 @@ std::shared_ptr<proving_key> UltraComposer::compute_proving_key(CircuitBuilder&
     const size_t subgroup_size = compute_dyadic_circuit_size(circuit);
 
     auto crs = srs::get_bn254_crs_factory()->get_prover_crs(subgroup_size + 1);
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/392): Composer type
-    circuit_proving_key =
-        std::make_shared<plonk::proving_key>(subgroup_size, circuit.public_inputs.size(), crs, CircuitType::ULTRA);
 
-    // Construct and add to proving key the wire, selector and copy constraint polynomials
-    Trace::populate(circuit, circuit_proving_key);
+    // On a key cache hit, only the witness dependent polynomials remain to be computed
+    std::optional<proving_key_data> precomputed;
+    if (key_cache) {
+        circuit_hash = ProvingKeyCache::compute_circuit_hash(circuit);
+        precomputed = key_cache->get_proving_key(*circuit_hash);
+    }
+
+    if (precomputed) {
+        circuit_proving_key = std::make_shared<plonk::proving_key>(std::move(*precomputed), crs);
+
+        // Construct and add to proving key the wire polynomials
+        Trace::populate_wires(circuit, circuit_proving_key);
+    } else {
+        // TODO(https://github.com/AztecProtocol/barretenberg/issues/392): Composer type
+        circuit_proving_key =
+            std::make_shared<plonk::proving_key>(subgroup_size, circuit.public_inputs.size(), crs, CircuitType::ULTRA);
+
+        // Construct and add to proving key the wire, selector and copy constraint polynomials
+        Trace::populate(circuit, circuit_proving_key);
+
+        enforce_nonzero_selector_polynomials(circuit, circuit_proving_key.get());
+
+        compute_monomial_and_coset_selector_forms(circuit_proving_key.get(), ultra_selector_properties());
+
+        construct_table_polynomials(circuit, subgroup_size);
 
-    enforce_nonzero_selector_polynomials(circuit, circuit_proving_key.get());
+        circuit_proving_key->recursive_proof_public_input_indices = std::vector<uint32_t>(
+            circuit.recursive_proof_public_input_indices.begin(), circuit.recursive_proof_public_input_indices.end());
 
-    compute_monomial_and_coset_selector_forms(circuit_proving_key.get(), ultra_selector_properties());
+        circuit_proving_key->contains_recursive_proof = circuit.contains_recursive_proof;
 
-    construct_table_polynomials(circuit, subgroup_size);
+        if (key_cache) {
+            key_cache->put_proving_key(*circuit_hash, *circuit_proving_key);
+        }
+    }
 
     // Instantiate z_lookup and s polynomials in the proving key (no values assigned yet).
     // Note: might be better to add these polys to cache only after they've been computed, as is convention
@@ -181,11 +205,6 @@ std::shared_ptr<proving_key> UltraComposer::compute_proving_key(CircuitBuilder&
     circuit_proving_key->polynomial_store.put("z_lookup_fft", std::move(z_lookup_fft));
     circuit_proving_key->polynomial_store.put("s_fft", std::move(s_fft));
 
-    circuit_proving_key->recursive_proof_public_input_indices = std::vector<uint32_t>(
-        circuit.recursive_proof_public_input_indices.begin(), circuit.recursive_proof_public_input_indices.end());
-
-    circuit_proving_key->contains_recursive_proof = circuit.contains_recursive_proof;
-
     construct_sorted_polynomials(circuit, subgroup_size);
 
     return circuit_proving_key;
@@ -203,6 +222,17 @@ std::shared_ptr<plonk::verification_key> UltraComposer::compute_verification_key
         return circuit_verification_key;
     }
 
+    if (key_cache) {
+        if (!circuit_hash) {
+            circuit_hash = ProvingKeyCache::compute_circuit_hash(circuit_constructor);
+        }
+        if (auto cached_key = key_cache->get_verification_key(*circuit_hash)) {
+            circuit_verification_key = std::make_shared<plonk::verification_key>(
+                std::move(*cached_key), srs::get_bn254_crs_factory()->get_verifier_crs());
+            return circuit_verification_key;
+        }
+    }
+
     if (!circuit_proving_key) {
         compute_proving_key(circuit_constructor);
     }
@@ -220,6 +250,10 @@ std::shared_ptr<plonk::verification_key> UltraComposer::compute_verification_key
 
     circuit_verification_key->is_recursive_circuit = circuit_constructor.is_recursive_circuit;
 
+    if (key_cache) {
+        key_cache->put_verification_key(*circuit_hash, *circuit_verification_key);
+    }
+
     return circuit_verification_key;
 }
 
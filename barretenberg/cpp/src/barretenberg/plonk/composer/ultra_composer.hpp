@@ -4,6 +4,7 @@
 #include "barretenberg/plonk/composer/composer_lib.hpp"
 #include "barretenberg/plonk/proof_system/prover/prover.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
+#include "barretenberg/plonk/proof_system/proving_key/proving_key_cache.hpp"
 #include "barretenberg/plonk/proof_system/verifier/verifier.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
 #include "barretenberg/proof_system/composer/composer_lib.hpp"
@@ -28,6 +29,12 @@ class UltraComposer {
     std::shared_ptr<plonk::proving_key> circuit_proving_key;
     std::shared_ptr<plonk::verification_key> circuit_verification_key;
 
+    // If set, the precomputed part of the proving key and the verification key are read from the cache when present
+    // and written to it otherwise
+    std::shared_ptr<ProvingKeyCache> key_cache;
+    // The hash of the circuit, computed on first use of the key cache
+    std::optional<ProvingKeyCache::CircuitHash> circuit_hash;
+
     bool computed_witness = false;
 
     // This variable controls the amount with which the lookup table and witness values need to be shifted
@@ -0,0 +1,239 @@
+#include "proving_key_cache.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/srs/mapped_file.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <span>
+
+namespace bb::plonk {
+
+namespace {
+
+// Bump whenever the contents of a proving key or the file layout change, to invalidate existing entries
+constexpr uint32_t CACHE_FORMAT_VERSION = 1;
+
+// Polynomial data is aligned to a cache line within the (page aligned) mapping of a proving key file
+constexpr size_t POLYNOMIAL_ALIGNMENT = 64;
+
+constexpr size_t align_up(size_t offset)
+{
+    return (offset + POLYNOMIAL_ALIGNMENT - 1) & ~(POLYNOMIAL_ALIGNMENT - 1);
+}
+
+/**
+ * @brief Append the hash of the raw bytes of a contiguous container to a buffer
+ */
+template <typename Container> void append_hash(std::vector<uint8_t>& buf, Container const& container)
+{
+    using T = typename Container::value_type;
+    std::span<uint8_t> bytes(reinterpret_cast<uint8_t*>(const_cast<T*>(container.data())),
+                             container.size() * sizeof(T));
+    auto hash = crypto::sha256(bytes);
+    buf.insert(buf.end(), hash.begin(), hash.end());
+}
+
+/**
+ * @brief Write a buffer to `path` atomically, by way of a uniquely named temporary file
+ */
+void write_file_atomic(std::string const& path, std::vector<std::span<const uint8_t>> const& chunks)
+{
+    auto tmp_path = format(path, ".tmp", numeric::get_randomness().get_random_uint32());
+    std::ofstream file(tmp_path, std::ios::binary);
+    for (auto& chunk : chunks) {
+        file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+    }
+    file.close();
+    if (!file.good() || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        info("failed to write key cache entry: ", path);
+        std::remove(tmp_path.c_str());
+    }
+}
+
+} // namespace
+
+ProvingKeyCache::CircuitHash ProvingKeyCache::compute_circuit_hash(UltraCircuitBuilder& circuit)
+{
+    using serialize::write;
+    circuit.finalize_circuit();
+
+    std::vector<uint8_t> buf;
+    write(buf, CACHE_FORMAT_VERSION);
+    write(buf, static_cast<uint32_t>(CircuitType::ULTRA));
+    write(buf, static_cast<uint64_t>(circuit.num_gates));
+    write(buf, static_cast<uint64_t>(circuit.variables.size()));
+    write(buf, circuit.is_recursive_circuit);
+    write(buf, circuit.contains_recursive_proof);
+    write(buf, circuit.recursive_proof_public_input_indices);
+    write(buf, circuit.public_inputs);
+
+    // Gates
+    for (auto& block : circuit.blocks.get()) {
+        write(buf, static_cast<uint64_t>(block.size()));
+        for (auto& wire : block.wires) {
+            append_hash(buf, wire);
+        }
+        for (auto& selector : block.selectors) {
+            append_hash(buf, selector);
+        }
+    }
+
+    // Copy constraints, including those of the generalized permutation
+    append_hash(buf, circuit.real_variable_index);
+    append_hash(buf, circuit.real_variable_tags);
+    for (auto [tag, tau_tag] : circuit.tau) {
+        write(buf, tag);
+        write(buf, tau_tag);
+    }
+
+    // Lookup tables
+    for (auto& table : circuit.lookup_tables) {
+        write(buf, static_cast<uint64_t>(table.id));
+        write(buf, static_cast<uint64_t>(table.table_index));
+        write(buf, table.use_twin_keys);
+        append_hash(buf, table.column_1);
+        append_hash(buf, table.column_2);
+        append_hash(buf, table.column_3);
+    }
+
+    // RAM/ROM
+    write(buf, circuit.memory_read_records);
+    write(buf, circuit.memory_write_records);
+
+    return crypto::sha256(buf);
+}
+
+std::string ProvingKeyCache::get_path(CircuitHash const& circuit_hash, std::string const& extension) const
+{
+    std::ostringstream name;
+    name << directory << "/" << circuit_hash << extension;
+    return name.str();
+}
+
+/**
+ * @brief Map the proving key file for a circuit, if there is one. The polynomials of the returned key data point
+ * into the mapping.
+ */
+std::optional<proving_key_data> ProvingKeyCache::get_proving_key(CircuitHash const& circuit_hash)
+{
+    using serialize::read;
+
+    size_t file_size = 0;
+    auto mapping = srs::map_file_private(get_path(circuit_hash, ".pk"), file_size);
+    if (!mapping || file_size < sizeof(uint32_t)) {
+        num_misses++;
+        return std::nullopt;
+    }
+    auto* file_start = static_cast<uint8_t*>(mapping.get());
+    const uint8_t* it = file_start;
+
+    uint32_t header_size = 0;
+    read(it, header_size);
+    if (sizeof(uint32_t) + header_size > file_size) {
+        num_misses++;
+        return std::nullopt;
+    }
+    const size_t data_start = align_up(sizeof(uint32_t) + header_size);
+
+    proving_key_data key;
+    uint32_t num_polynomials = 0;
+    read(it, key.circuit_type);
+    read(it, key.circuit_size);
+    read(it, key.num_public_inputs);
+    read(it, num_polynomials);
+    for (size_t i = 0; i < num_polynomials; ++i) {
+        std::string label;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint64_t capacity = 0;
+        read(it, label);
+        read(it, offset);
+        read(it, size);
+        read(it, capacity);
+        if (data_start + offset + capacity * sizeof(fr) > file_size) {
+            info("ignoring truncated key cache entry: ", get_path(circuit_hash, ".pk"));
+            num_misses++;
+            return std::nullopt;
+        }
+        // The polynomial shares ownership of the mapping
+        std::shared_ptr<fr[]> coefficients(mapping, reinterpret_cast<fr*>(file_start + data_start + offset));
+        key.polynomial_store.put(label, polynomial(coefficients, size));
+    }
+    read(it, key.contains_recursive_proof);
+    read(it, key.recursive_proof_public_input_indices);
+    read(it, key.memory_read_records);
+    read(it, key.memory_write_records);
+
+    num_hits++;
+    return key;
+}
+
+/**
+ * @brief Store the precomputed polynomials of a proving key
+ */
+void ProvingKeyCache::put_proving_key(CircuitHash const& circuit_hash, proving_key& key)
+{
+    using serialize::write;
+
+    PrecomputedPolyList precomputed_poly_list(key.circuit_type);
+    std::vector<polynomial> polynomials;
+
+    std::vector<uint8_t> header;
+    write(header, static_cast<uint32_t>(key.circuit_type));
+    write(header, static_cast<uint32_t>(key.circuit_size));
+    write(header, static_cast<uint32_t>(key.num_public_inputs));
+    write(header, static_cast<uint32_t>(precomputed_poly_list.size()));
+    size_t offset = 0;
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        std::string label = precomputed_poly_list[i];
+        auto value = key.polynomial_store.get(label);
+        write(header, label);
+        write(header, static_cast<uint64_t>(offset));
+        write(header, static_cast<uint64_t>(value.size()));
+        write(header, static_cast<uint64_t>(value.capacity()));
+        offset += align_up(value.capacity() * sizeof(fr));
+        polynomials.emplace_back(std::move(value));
+    }
+    write(header, key.contains_recursive_proof);
+    write(header, key.recursive_proof_public_input_indices);
+    write(header, key.memory_read_records);
+    write(header, key.memory_write_records);
+
+    std::vector<uint8_t> header_size;
+    write(header_size, static_cast<uint32_t>(header.size()));
+    // Zeroes used to pad each section to the alignment, and to fill the (zero) padding coefficients of polynomials
+    const std::vector<uint8_t> zeroes(POLYNOMIAL_ALIGNMENT + sizeof(fr) * 2);
+
+    std::vector<std::span<const uint8_t>> chunks{ header_size, header };
+    const size_t header_end = header_size.size() + header.size();
+    chunks.emplace_back(zeroes.data(), align_up(header_end) - header_end);
+    for (auto& value : polynomials) {
+        const size_t num_bytes = value.size() * sizeof(fr);
+        const size_t padded_num_bytes = align_up(value.capacity() * sizeof(fr));
+        chunks.emplace_back(reinterpret_cast<const uint8_t*>(value.begin()), num_bytes);
+        chunks.emplace_back(zeroes.data(), padded_num_bytes - num_bytes);
+    }
+    write_file_atomic(get_path(circuit_hash, ".pk"), chunks);
+}
+
+std::optional<verification_key_data> ProvingKeyCache::get_verification_key(CircuitHash const& circuit_hash)
+{
+    std::ifstream file(get_path(circuit_hash, ".vk"), std::ios::binary);
+    if (!file) {
+        num_misses++;
+        return std::nullopt;
+    }
+    std::vector<uint8_t> buf((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    num_hits++;
+    return from_buffer<verification_key_data>(buf);
+}
+
+void ProvingKeyCache::put_verification_key(CircuitHash const& circuit_hash, verification_key const& key)
+{
+    auto buf = to_buffer(key);
+    write_file_atomic(get_path(circuit_hash, ".vk"), { buf });
+}
+
+} // namespace bb::plonk
@@ -0,0 +1,61 @@
+#pragma once
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
+#include "barretenberg/plonk/proof_system/verification_key/verification_key.hpp"
+#include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+#include <atomic>
+#include <optional>
+#include <string>
+
+namespace bb::plonk {
+
+/**
+ * @brief An on-disk cache of Ultra Plonk verification keys and of the precomputed part of proving keys, addressed by a
+ * hash of the circuit structure
+ * @details The precomputed part of a proving key (selector, permutation and table polynomials in all of their forms)
+ * depends only on the structure of the circuit, not on its witness. When the same circuit is proven repeatedly, it can
+ * therefore be computed once and read back for every subsequent proof, leaving only the witness dependent polynomials
+ * to be computed.
+ *
+ * Each proving key is stored in a single file, `<circuit hash>.pk`, holding a small header followed by the raw
+ * polynomial data, aligned such that the file can be memory mapped and its polynomials used in place. The mapping is
+ * private, so the prover may modify the polynomials without altering the file. Verification keys are stored as
+ * `<circuit hash>.vk` in the usual serialized form. Entries are written to a temporary file and renamed into place, so
+ * concurrent provers sharing a cache directory never read a partially written entry.
+ */
+class ProvingKeyCache {
+  public:
+    using CircuitHash = crypto::Sha256Hash;
+
+    /**
+     * @param directory An existing directory in which to store the keys
+     */
+    ProvingKeyCache(std::string directory)
+        : directory(std::move(directory))
+    {}
+
+    /**
+     * @brief Hash everything about a circuit that the keys depend on: its gates, copy constraints, lookup tables and
+     * memory records. Finalizes the circuit.
+     */
+    static CircuitHash compute_circuit_hash(UltraCircuitBuilder& circuit);
+
+    std::optional<proving_key_data> get_proving_key(CircuitHash const& circuit_hash);
+    void put_proving_key(CircuitHash const& circuit_hash, proving_key& key);
+
+    std::optional<verification_key_data> get_verification_key(CircuitHash const& circuit_hash);
+    void put_verification_key(CircuitHash const& circuit_hash, verification_key const& key);
+
+    // The number of lookups (of either type of key) that found, respectively did not find, an entry in the cache
+    size_t get_num_hits() const { return num_hits; }
+    size_t get_num_misses() const { return num_misses; }
+
+  private:
+    std::string directory;
+    std::atomic<size_t> num_hits = 0;
+    std::atomic<size_t> num_misses = 0;
+
+    std::string get_path(CircuitHash const& circuit_hash, std::string const& extension) const;
+};
+
+} // namespace bb::plonk
@@ -0,0 +1,139 @@
+#include "proving_key_cache.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+
+#include <filesystem>
+
+using namespace bb;
+using namespace bb::plonk;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+class ProvingKeyCacheTests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
+
+    void SetUp() override
+    {
+        cache_dir = std::filesystem::temp_directory_path() /
+                    ("bb_proving_key_cache_test_" + std::to_string(engine.get_random_uint32()));
+        std::filesystem::create_directories(cache_dir);
+        cache = std::make_shared<ProvingKeyCache>(cache_dir.string());
+    }
+
+    void TearDown() override { std::filesystem::remove_all(cache_dir); }
+
+    /**
+     * @brief Build a circuit with lookups, range constraints and RAM. The structure of the circuit is fixed but the
+     * witness is random.
+     */
+    static UltraCircuitBuilder build_circuit()
+    {
+        UltraCircuitBuilder builder;
+
+        const fr left(engine.get_random_uint32());
+        const fr right(engine.get_random_uint32());
+        const auto left_idx = builder.add_variable(left);
+        const auto right_idx = builder.add_variable(right);
+        const auto accumulators =
+            plookup::get_lookup_accumulators(plookup::MultiTableId::UINT32_XOR, left, right, /*is_2_to_1_lookup=*/true);
+        builder.create_gates_from_plookup_accumulators(
+            plookup::MultiTableId::UINT32_XOR, accumulators, left_idx, right_idx);
+
+        const auto range_idx = builder.add_variable(engine.get_random_uint8());
+        builder.create_new_range_constraint(range_idx, 255);
+
+        const size_t ram_id = builder.create_RAM_array(4);
+        for (size_t i = 0; i < 4; ++i) {
+            builder.init_RAM_element(ram_id, i, builder.add_variable(fr::random_element()));
+        }
+        builder.write_RAM_array(ram_id, builder.add_variable(2), builder.add_variable(fr::random_element()));
+        const auto a_idx = builder.read_RAM_array(ram_id, builder.add_variable(2));
+        const auto b_idx = builder.read_RAM_array(ram_id, builder.add_variable(3));
+
+        // Use the range constrained and RAM variables in a gate, exposing the result as a public input
+        const auto d_idx = builder.add_variable(builder.get_variable(a_idx) + builder.get_variable(b_idx) +
+                                                builder.get_variable(range_idx));
+        builder.create_big_add_gate({ a_idx, b_idx, range_idx, d_idx, 1, 1, 1, -1, 0 });
+        builder.set_public_input(d_idx);
+
+        return builder;
+    }
+
+    static bool prove_and_verify(UltraCircuitBuilder& builder, UltraComposer& composer)
+    {
+        auto prover = composer.create_prover(builder);
+        auto verifier = composer.create_verifier(builder);
+        auto proof = prover.construct_proof();
+        return verifier.verify_proof(proof);
+    }
+
+    std::filesystem::path cache_dir;
+    std::shared_ptr<ProvingKeyCache> cache;
+};
+} // namespace
+
+/**
+ * @brief The circuit hash depends on the structure of a circuit only, not on its witness
+ */
+TEST_F(ProvingKeyCacheTests, CircuitHash)
+{
+    auto builder_1 = build_circuit();
+    auto builder_2 = build_circuit();
+    EXPECT_EQ(ProvingKeyCache::compute_circuit_hash(builder_1), ProvingKeyCache::compute_circuit_hash(builder_2));
+
+    auto builder_3 = build_circuit();
+    builder_3.create_new_range_constraint(builder_3.add_variable(1), 1);
+    EXPECT_NE(ProvingKeyCache::compute_circuit_hash(builder_1), ProvingKeyCache::compute_circuit_hash(builder_3));
+}
+
+/**
+ * @brief A proving key read from the cache has the same polynomials as one computed from scratch, and both keys yield
+ * valid proofs
+ */
+TEST_F(ProvingKeyCacheTests, ProveFromCachedKeys)
+{
+    auto cold_builder = build_circuit();
+    UltraComposer cold_composer;
+    cold_composer.key_cache = cache;
+    EXPECT_TRUE(prove_and_verify(cold_builder, cold_composer));
+    EXPECT_EQ(cache->get_num_hits(), 0);
+    EXPECT_EQ(cache->get_num_misses(), 2);
+
+    auto warm_builder = build_circuit();
+    UltraComposer warm_composer;
+    warm_composer.key_cache = cache;
+    EXPECT_TRUE(prove_and_verify(warm_builder, warm_composer));
+    EXPECT_EQ(cache->get_num_hits(), 2);
+    EXPECT_EQ(cache->get_num_misses(), 2);
+
+    auto& cold_key = *cold_composer.circuit_proving_key;
+    auto& warm_key = *warm_composer.circuit_proving_key;
+    PrecomputedPolyList precomputed_poly_list(cold_key.circuit_type);
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        const auto& label = precomputed_poly_list[i];
+        EXPECT_EQ(cold_key.polynomial_store.get(label), warm_key.polynomial_store.get(label)) << label;
+    }
+    EXPECT_EQ(cold_key.memory_read_records, warm_key.memory_read_records);
+    EXPECT_EQ(cold_key.memory_write_records, warm_key.memory_write_records);
+    EXPECT_EQ(cold_composer.circuit_verification_key->as_data(), warm_composer.circuit_verification_key->as_data());
+}
+
+/**
+ * @brief A truncated entry is treated as a miss
+ */
+TEST_F(ProvingKeyCacheTests, TruncatedEntry)
+{
+    auto builder = build_circuit();
+    UltraComposer composer;
+    composer.key_cache = cache;
+    composer.compute_proving_key(builder);
+
+    const auto circuit_hash = ProvingKeyCache::compute_circuit_hash(builder);
+    for (auto& entry : std::filesystem::directory_iterator(cache_dir)) {
+        std::filesystem::resize_file(entry.path(), std::filesystem::file_size(entry.path()) / 2);
+    }
+    EXPECT_FALSE(cache->get_proving_key(circuit_hash).has_value());
+}
@@ -2,6 +2,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_batch.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "polynomial_arithmetic.hpp"
 #include <cstddef>
@@ -91,6 +92,14 @@ template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficien
     zero_memory_beyond(size_);
 }
 
+template <typename Fr>
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+Polynomial<Fr>::Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size)
+    : backing_memory_(std::move(backing_memory))
+    , coefficients_(backing_memory_.get())
+    , size_(size)
+{}
+
 // interpolation constructor
 template <typename Fr>
 Polynomial<Fr>::Polynomial(std::span<const Fr> interpolation_points, std::span<const Fr> evaluations)
@@ -374,9 +383,8 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_[i] += scaling_factor * other[i];
-        }
+        std::span<Fr> chunk(coefficients_ + offset, end - offset);
+        fma_n<Fr>(chunk, other.subspan(offset, end - offset), scaling_factor, chunk);
     });
 }
 
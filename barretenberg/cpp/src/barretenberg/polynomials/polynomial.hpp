@@ -35,6 +35,11 @@ template <typename Fr> class Polynomial {
     // Create a polynomial from the given fields.
     Polynomial(std::span<const Fr> coefficients);
 
+    // Create a polynomial over existing memory (e.g. a memory mapped file) holding at least size +
+    // MAXIMUM_COEFFICIENT_SHIFT coefficients, the last of which are zero. The memory is not copied.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size);
+
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
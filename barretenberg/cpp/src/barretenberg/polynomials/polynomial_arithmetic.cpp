@@ -3,8 +3,10 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_batch.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include <algorithm>
 #include <math.h>
 #include <memory.h>
 #include <memory>
@@ -30,6 +32,17 @@ template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_
 #endif
 }
 
+// The twiddle factor multiplications of an FFT round are batched in blocks of (up to) this many butterflies
+constexpr size_t FFT_BATCH_SIZE = 64;
+
+/**
+ * @brief products[l] = round_roots[l] * values[l] for l < n, see field_batch.hpp
+ */
+template <typename Fr> void twiddle_products(Fr* products, const Fr* round_roots, const Fr* values, size_t n)
+{
+    mul_n<Fr>(std::span<Fr>(products, n), std::span<const Fr>(round_roots, n), std::span<const Fr>(values, n));
+}
+
 } // namespace
 
 inline uint32_t reverse_bits(uint32_t x, uint32_t bit_length)
@@ -168,6 +181,177 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
     }
 }
 
+// The rounds of an FFT over blocks of up to this many elements (128KB of fr) are performed one block at a time, while
+// the block is in L2
+constexpr size_t FFT_BLOCK_SIZE = 1UL << 12;
+
+/**
+ * @brief Radix-2 butterflies i in [start, end) of round m, i.e. of the elements m apart, of a decimation-in-time FFT,
+ * in place
+ *
+ * @details The butterflies are processed in batches, multiplying by the roots in one go. In the rounds m < batch_size
+ * a batch spans several blocks of 2m elements, and the roots and odd elements of its butterflies are gathered first.
+ */
+template <typename Fr>
+void fft_radix_2_butterflies(Fr* values, const size_t m, const Fr* round_roots, const size_t start, const size_t end)
+{
+    std::array<Fr, FFT_BATCH_SIZE> temps;
+    std::array<Fr, FFT_BATCH_SIZE> batch_roots;
+    // As m, end - start and FFT_BATCH_SIZE are powers of 2, batches start at multiples of batch_size
+    const size_t batch_size = std::min(end - start, FFT_BATCH_SIZE);
+    const bool gather = m < batch_size;
+    if (gather) {
+        for (size_t l = 0; l < batch_size; ++l) {
+            batch_roots[l] = round_roots[l & (m - 1)];
+        }
+    }
+    for (size_t i = start; i < end; i += batch_size) {
+        // Butterfly i + l combines the elements even_index(l) and even_index(l) + m
+        const auto even_index = [i, m](size_t l) { return ((i + l) << 1) - ((i + l) & (m - 1)); };
+        if (gather) {
+            for (size_t l = 0; l < batch_size; ++l) {
+                temps[l] = values[even_index(l) + m];
+            }
+            twiddle_products(temps.data(), batch_roots.data(), temps.data(), batch_size);
+        } else {
+            twiddle_products(temps.data(), &round_roots[i & (m - 1)], &values[even_index(0) + m], batch_size);
+        }
+        for (size_t l = 0; l < batch_size; ++l) {
+            const size_t k = even_index(l);
+            values[k + m] = values[k] - temps[l];
+            values[k] += temps[l];
+        }
+    }
+}
+
+/**
+ * @brief Radix-4 butterflies i in [start, end) of rounds m and 2m, i.e. of the elements m apart then 2m apart, in
+ * place, in one sweep over the elements
+ */
+template <typename Fr>
+void fft_radix_4_butterflies(Fr* values,
+                             const size_t m,
+                             const Fr* round_roots,
+                             const Fr* next_round_roots,
+                             const size_t start,
+                             const size_t end)
+{
+    std::array<Fr, FFT_BATCH_SIZE> lower_temps;
+    std::array<Fr, FFT_BATCH_SIZE> upper_temps;
+    std::array<Fr, FFT_BATCH_SIZE> batch_roots;
+    std::array<Fr, FFT_BATCH_SIZE> batch_next_roots;
+    std::array<Fr, FFT_BATCH_SIZE> batch_shifted_next_roots;
+    const size_t batch_size = std::min(end - start, FFT_BATCH_SIZE);
+    const bool gather = m < batch_size;
+    if (gather) {
+        for (size_t l = 0; l < batch_size; ++l) {
+            batch_roots[l] = round_roots[l & (m - 1)];
+            batch_next_roots[l] = next_round_roots[l & (m - 1)];
+            batch_shifted_next_roots[l] = next_round_roots[(l & (m - 1)) + m];
+        }
+    }
+    // Products of the roots with the elements offset + first_index(l), l < batch_size
+    const auto products = [&](Fr* result, const auto& first_index, const Fr* roots, size_t offset) {
+        if (gather) {
+            for (size_t l = 0; l < batch_size; ++l) {
+                result[l] = values[first_index(l) + offset];
+            }
+            twiddle_products(result, roots, result, batch_size);
+        } else {
+            twiddle_products(result, roots, &values[first_index(0) + offset], batch_size);
+        }
+    };
+    for (size_t i = start; i < end; i += batch_size) {
+        // Butterfly i + l combines the elements first_index(l) + {0, m, 2m, 3m}
+        const auto first_index = [i, m](size_t l) { return ((i + l) << 2) - 3 * ((i + l) & (m - 1)); };
+        const size_t j = i & (m - 1);
+        // Round m: (x0, x1) and (x2, x3) by ω_2m^j
+        const Fr* roots = gather ? batch_roots.data() : &round_roots[j];
+        products(lower_temps.data(), first_index, roots, m);
+        products(upper_temps.data(), first_index, roots, 3 * m);
+        for (size_t l = 0; l < batch_size; ++l) {
+            const size_t k = first_index(l);
+            values[k + m] = values[k] - lower_temps[l];
+            values[k] += lower_temps[l];
+            values[k + 3 * m] = values[k + 2 * m] - upper_temps[l];
+            values[k + 2 * m] += upper_temps[l];
+        }
+        // Round 2m: (x0, x2) by ω_4m^j and (x1, x3) by ω_4m^(j + m)
+        products(lower_temps.data(), first_index, gather ? batch_next_roots.data() : &next_round_roots[j], 2 * m);
+        products(upper_temps.data(),
+                 first_index,
+                 gather ? batch_shifted_next_roots.data() : &next_round_roots[j + m],
+                 3 * m);
+        for (size_t l = 0; l < batch_size; ++l) {
+            const size_t k = first_index(l);
+            values[k + 2 * m] = values[k] - lower_temps[l];
+            values[k] += lower_temps[l];
+            values[k + 3 * m] = values[k + m] - upper_temps[l];
+            values[k + m] += upper_temps[l];
+        }
+    }
+}
+
+/**
+ * @brief Rounds m_begin, 2 m_begin, ..., m_end / 2 over the elements [start, end) of values, which are independent of
+ * the others over these rounds. Pairs of rounds are done as radix-4
+ */
+template <typename Fr>
+void fft_rounds(Fr* values,
+                const std::vector<Fr*>& root_table,
+                size_t m_begin,
+                const size_t m_end,
+                const size_t start,
+                const size_t end)
+{
+    for (size_t m = m_begin; m < m_end;) {
+        const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+        if (4 * m <= m_end) {
+            const Fr* next_round_roots = root_table[static_cast<size_t>(numeric::get_msb(m))];
+            fft_radix_4_butterflies(values, m, round_roots, next_round_roots, start >> 2, end >> 2);
+            m <<= 2;
+        } else {
+            fft_radix_2_butterflies(values, m, round_roots, start >> 1, end >> 1);
+            m <<= 1;
+        }
+    }
+}
+
+/**
+ * @brief FFT of the domain.size elements input(i), into result
+ *
+ * @details The rounds m < FFT_BLOCK_SIZE only combine elements within blocks of FFT_BLOCK_SIZE consecutive elements (in
+ * bit-reversed order). Each block is gathered in bit-reversed order, with the first round fused in, then taken through
+ * these rounds while it is in cache. The remaining rounds are done two at a time (radix-4), in one sweep over the
+ * elements each, instead of one sweep per round.
+ */
+template <typename Fr, typename Input>
+void fft_blocked(const Input& input, Fr* result, const EvaluationDomain<Fr>& domain, const std::vector<Fr*>& root_table)
+{
+    const size_t block_size = std::min(FFT_BLOCK_SIZE, domain.thread_size);
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const size_t thread_end = (j + 1) * domain.thread_size;
+        for (size_t block_start = j * domain.thread_size; block_start < thread_end; block_start += block_size) {
+            const size_t block_end = block_start + block_size;
+            for (size_t i = block_start; i < block_end; i += 2) {
+                const Fr odd =
+                    input(reverse_bits(static_cast<uint32_t>(i + 1), static_cast<uint32_t>(domain.log2_size)));
+                result[i] = input(reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(domain.log2_size)));
+                result[i + 1] = result[i] - odd;
+                result[i] += odd;
+            }
+            fft_rounds(result, root_table, 2, block_size, block_start, block_end);
+        }
+    });
+
+    for (size_t m = block_size; m < domain.size; m <<= 2) {
+        parallel_for(domain.num_threads, [&](size_t j) {
+            const size_t start = j * domain.thread_size;
+            fft_rounds(result, root_table, m, std::min(m << 2, domain.size), start, start + domain.thread_size);
+        });
+    }
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_inner_parallel(std::vector<Fr*> coeffs,
@@ -185,115 +369,17 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
     const size_t poly_mask = poly_size - 1;
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
 
+    fft_blocked(
+        [&](size_t index) { return coeffs[index >> log2_poly_size][index & poly_mask]; },
+        scratch_space,
+        domain,
+        root_table);
+
     parallel_for(domain.num_threads, [&](size_t j) {
-        Fr temp_1;
-        Fr temp_2;
-        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-            __builtin_prefetch(&coeffs[next_index_1]);
-            __builtin_prefetch(&coeffs[next_index_2]);
-
-            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-            size_t poly_idx_1 = swap_index_1 >> log2_poly_size;
-            size_t elem_idx_1 = swap_index_1 & poly_mask;
-            size_t poly_idx_2 = swap_index_2 >> log2_poly_size;
-            size_t elem_idx_2 = swap_index_2 & poly_mask;
-
-            Fr::__copy(coeffs[poly_idx_1][elem_idx_1], temp_1);
-            Fr::__copy(coeffs[poly_idx_2][elem_idx_2], temp_2);
-            scratch_space[i + 1] = temp_1 - temp_2;
-            scratch_space[i] = temp_1 + temp_2;
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); ++i) {
+            Fr::__copy(scratch_space[i], coeffs[i >> log2_poly_size][i & poly_mask]);
         }
     });
-
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-    // reduce + copy
-    if (domain.size <= 2) {
-        coeffs[0][0] = scratch_space[0];
-        coeffs[0][1] = scratch_space[1];
-    }
-
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            if (m != (domain.size >> 1)) {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                    scratch_space[k1 + j1] += temp;
-                }
-            } else {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-
-                    size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
-                    size_t elem_idx_1 = (k1 + j1) & poly_mask;
-                    size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
-                    size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
-
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
-                    coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
-                }
-            }
-        });
-    }
 }
 
 template <typename Fr>
@@ -301,94 +387,13 @@ template <typename Fr>
 void fft_inner_parallel(
     Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
 {
-    parallel_for(domain.num_threads, [&](size_t j) {
-        Fr temp_1;
-        Fr temp_2;
-        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-            __builtin_prefetch(&coeffs[next_index_1]);
-            __builtin_prefetch(&coeffs[next_index_2]);
-
-            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-            Fr::__copy(coeffs[swap_index_1], temp_1);
-            Fr::__copy(coeffs[swap_index_2], temp_2);
-            target[i + 1] = temp_1 - temp_2;
-            target[i] = temp_1 + temp_2;
-        }
-    });
+    fft_blocked([coeffs](size_t index) { return coeffs[index]; }, target, domain, root_table);
 
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-    // reduce + copy
+    // hard code exception for when the domain size is tiny
     if (domain.size <= 2) {
         coeffs[0] = target[0];
         coeffs[1] = target[1];
     }
-
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            for (size_t i = start; i < end; ++i) {
-                size_t k1 = (i & index_mask) << 1;
-                size_t j1 = i & block_mask;
-                temp = round_roots[j1] * target[k1 + j1 + m];
-                target[k1 + j1 + m] = target[k1 + j1] - temp;
-                target[k1 + j1] += temp;
-            }
-        });
-    }
 }
 
 template <typename Fr>
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <gtest/gtest.h>
 #include <utility>
+#include <vector>
 
 using namespace bb;
 
@@ -136,6 +137,31 @@ TEST(polynomials, basic_fft)
     aligned_free(data);
 }
 
+/**
+ * @brief Domains larger than a block of the blocked FFT, with an odd (radix-2 last pass) and an even number of rounds
+ * outside the blocks, against the serial FFT
+ */
+TEST(polynomials, fft_across_blocks)
+{
+    for (const size_t n : { size_t(1) << 13, size_t(1) << 14 }) {
+        std::vector<fr> result(n);
+        std::vector<fr> expected(n);
+        for (size_t i = 0; i < n; ++i) {
+            result[i] = fr::random_element();
+            expected[i] = result[i];
+        }
+
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+        polynomial_arithmetic::fft(result.data(), domain);
+        polynomial_arithmetic::fft_inner_serial({ expected.data() }, n, domain.get_round_roots());
+
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], expected[i]);
+        }
+    }
+}
+
 TEST(polynomials, fft_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -10,6 +10,7 @@
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/io.hpp"
 #include <benchmark/benchmark.h>
+#include <vector>
 
 using namespace benchmark;
 using namespace bb;
@@ -248,6 +249,54 @@ void fft_bench_serial(State& state) noexcept
 }
 BENCHMARK(fft_bench_serial)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+/**
+ * @brief fft, coset_fft and ifft of a single polynomial, each over its own domain and data, from 2^12 to 2^24 elements
+ */
+struct FftSweepInputs {
+    bb::evaluation_domain domain;
+    std::vector<fr> coefficients;
+
+    explicit FftSweepInputs(size_t size)
+        : domain(size)
+        , coefficients(size)
+    {
+        domain.compute_lookup_table();
+        fr T0 = fr::random_element();
+        fr acc = T0;
+        for (auto& coefficient : coefficients) {
+            acc *= T0;
+            coefficient = acc;
+        }
+    }
+};
+
+void fft_sweep_bench(State& state) noexcept
+{
+    FftSweepInputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::fft(inputs.coefficients.data(), inputs.domain);
+    }
+}
+BENCHMARK(fft_sweep_bench)->RangeMultiplier(4)->Range(1 << 12, 1 << 24)->Unit(benchmark::kMicrosecond);
+
+void coset_fft_sweep_bench(State& state) noexcept
+{
+    FftSweepInputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::coset_fft(inputs.coefficients.data(), inputs.domain);
+    }
+}
+BENCHMARK(coset_fft_sweep_bench)->RangeMultiplier(4)->Range(1 << 12, 1 << 24)->Unit(benchmark::kMicrosecond);
+
+void ifft_sweep_bench(State& state) noexcept
+{
+    FftSweepInputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::ifft(inputs.coefficients.data(), inputs.domain);
+    }
+}
+BENCHMARK(ifft_sweep_bench)->RangeMultiplier(4)->Range(1 << 12, 1 << 24)->Unit(benchmark::kMicrosecond);
+
 void pairing_bench(State& state) noexcept
 {
     uint64_t count = 0;
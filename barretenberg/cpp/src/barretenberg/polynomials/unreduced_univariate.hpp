@@ -0,0 +1,42 @@
+#pragma once
+#include "barretenberg/ecc/fields/unreduced_accumulator.hpp"
+#include "barretenberg/polynomials/univariate.hpp"
+
+namespace bb {
+
+/**
+ * @brief An accumulator for a sum of scaled univariates that defers the Montgomery reductions of its products
+ * @details Each evaluation is an unreduced_accumulator, so add_scaled costs one 512-bit product and a wide addition
+ * per evaluation instead of a full field multiplication and addition. reduce returns the sum as a Univariate.
+ *
+ * Relations can accumulate into these in place of Univariates (see SubrelationAccumulator and accumulate_scaled in
+ * relation_types.hpp); they compute their contributions in the corresponding Univariate type.
+ */
+template <class Fr, size_t domain_end, size_t domain_start = 0> class UnreducedUnivariate {
+  public:
+    static constexpr size_t LENGTH = domain_end - domain_start;
+    using Reduced = Univariate<Fr, domain_end, domain_start>;
+
+    std::array<unreduced_accumulator<Fr>, LENGTH> evaluations{};
+
+    /**
+     * @brief Add value * scalar
+     */
+    void add_scaled(const Reduced& value, const Fr& scalar)
+    {
+        for (size_t i = 0; i < LENGTH; ++i) {
+            evaluations[i].add_product(value.evaluations[i], scalar);
+        }
+    }
+
+    [[nodiscard]] Reduced reduce() const
+    {
+        Reduced result;
+        for (size_t i = 0; i < LENGTH; ++i) {
+            result.evaluations[i] = evaluations[i].reduce();
+        }
+        return result;
+    }
+};
+
+} // namespace bb
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/common/ref_array.hpp"
+#include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/proof_system/types/circuit_type.hpp"
 #include <array>
@@ -32,6 +33,15 @@ namespace bb {
  * We should only do this if it becomes necessary or convenient.
  */
 
+/**
+ * @brief The layout of the blocks in the execution trace
+ * @details With NONE the blocks are placed one after the other. Otherwise the trace is structured: each block is given
+ * a fixed capacity and hence placed at a fixed offset (see UltraHonkArith::TraceBlocks::set_fixed_block_sizes). All
+ * circuits that fit a given structure then have the same size and the same location for each type of gate, e.g. the
+ * kernel circuits folded in a ClientIVC.
+ */
+enum class TraceStructure { NONE, SMALL_TEST, CLIENT_IVC_BENCH };
+
 /**
  * @brief Basic structure for storing gate data in a builder
  *
@@ -48,7 +58,9 @@ template <typename FF, size_t NUM_WIRES, size_t NUM_SELECTORS> class ExecutionTr
 
     Wires wires; // vectors of indices into a witness variables array
     Selectors selectors;
-    bool has_ram_rom = false; // does the block contain RAM/ROM gates
+    bool has_ram_rom = false;  // does the block contain RAM/ROM gates
+    uint32_t trace_offset = 0; // where the block starts in the trace, set when the trace is constructed
+    uint32_t fixed_size = 0;   // the capacity of the block in a structured trace
 
     bool operator==(const ExecutionTraceBlock& other) const = default;
 
@@ -263,6 +275,13 @@ template <typename FF_> class UltraHonkArith {
         UltraHonkTraceBlock poseidon_external;
         UltraHonkTraceBlock poseidon_internal;
 
+        // Block capacities of the structured traces, in the order of get()
+        static constexpr std::array<uint32_t, 10> SMALL_TEST_STRUCTURE{ 1 << 8, 1 << 5, 1 << 10, 1 << 9, 1 << 8,
+                                                                        1 << 9, 1 << 10, 1 << 6, 1 << 8, 1 << 8 };
+        static constexpr std::array<uint32_t, 10> CLIENT_IVC_BENCH_STRUCTURE{ 1 << 10, 1 << 7, 1 << 16, 1 << 15,
+                                                                              1 << 14, 1 << 16, 1 << 15, 1 << 7,
+                                                                              1 << 11, 1 << 14 };
+
         TraceBlocks() { aux.has_ram_rom = true; }
 
         auto get()
@@ -271,6 +290,39 @@ template <typename FF_> class UltraHonkArith {
                              aux,    lookup,     busread,    poseidon_external, poseidon_internal };
         }
 
+        /**
+         * @brief Set the capacity of each block for the given trace structure
+         */
+        void set_fixed_block_sizes(TraceStructure setting)
+        {
+            std::array<uint32_t, 10> fixed_block_sizes{};
+            switch (setting) {
+            case TraceStructure::NONE:
+                break;
+            case TraceStructure::SMALL_TEST:
+                fixed_block_sizes = SMALL_TEST_STRUCTURE;
+                break;
+            case TraceStructure::CLIENT_IVC_BENCH:
+                fixed_block_sizes = CLIENT_IVC_BENCH_STRUCTURE;
+                break;
+            }
+            for (auto [block, size] : zip_view(this->get(), fixed_block_sizes)) {
+                block.fixed_size = size;
+            }
+        }
+
+        /**
+         * @brief The number of rows taken by the blocks of a structured trace, i.e. the sum of their capacities
+         */
+        size_t get_structured_size()
+        {
+            size_t structured_size = 0;
+            for (auto& block : this->get()) {
+                structured_size += block.fixed_size;
+            }
+            return structured_size;
+        }
+
         void summarize()
         {
             info("Gate blocks summary:");
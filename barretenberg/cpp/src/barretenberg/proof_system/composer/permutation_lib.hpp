@@ -150,15 +150,9 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Add information about public inputs to the computation
     const auto num_public_inputs = static_cast<uint32_t>(circuit_constructor.public_inputs.size());
 
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/862): this is brittle. depends on when PI are placed.
-    // how can we make this more robust?
-    // The public inputs are placed at the top of the execution trace, potentially offset by a zero row.
-    const size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
-    size_t pub_input_offset = num_zero_rows;
-    // If Goblin, PI are further offset by number of ecc op gates
-    if constexpr (IsGoblinFlavor<Flavor>) {
-        pub_input_offset += circuit_constructor.num_ecc_op_gates;
-    }
+    // The public inputs are placed at the start of the public inputs block, whose offset is set when the trace is
+    // constructed
+    const size_t pub_input_offset = circuit_constructor.blocks.pub_inputs.trace_offset;
     for (size_t i = 0; i < num_public_inputs; ++i) {
         size_t idx = i + pub_input_offset;
         mapping.sigmas[0][idx].row_index = static_cast<uint32_t>(idx);
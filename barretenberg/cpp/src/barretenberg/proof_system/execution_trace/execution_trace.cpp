@@ -1,4 +1,6 @@
 #include "execution_trace.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/flavor/plonk_flavors.hpp"
 #include "barretenberg/flavor/ultra.hpp"
@@ -7,10 +9,11 @@ namespace bb {
 
 template <class Flavor>
 void ExecutionTrace_<Flavor>::populate(Builder& builder,
-                                       const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
+                                       const std::shared_ptr<typename Flavor::ProvingKey>& proving_key,
+                                       bool is_structured)
 {
     // Construct wire polynomials, selector polynomials, and copy cycles from raw circuit data
-    auto trace_data = construct_trace_data(builder, proving_key->circuit_size);
+    auto trace_data = construct_trace_data(builder, proving_key->circuit_size, is_structured);
 
     add_wires_and_selectors_to_proving_key(trace_data, builder, proving_key);
 
@@ -22,10 +25,32 @@ void ExecutionTrace_<Flavor>::populate(Builder& builder,
         add_ecc_op_wires_to_proving_key(builder, proving_key);
     }
 
+    if constexpr (IsHonkFlavor<Flavor>) {
+        proving_key->active_row_ranges = std::move(trace_data.active_row_ranges);
+    }
+
     // Compute the permutation argument polynomials (sigma/id) and add them to proving key
     compute_permutation_argument_polynomials<Flavor>(builder, proving_key.get(), trace_data.copy_cycles);
 }
 
+template <class Flavor>
+void ExecutionTrace_<Flavor>::populate_wires(Builder& builder,
+                                             const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
+{
+    auto trace_data = construct_trace_data(builder, proving_key->circuit_size, /*is_structured=*/false);
+
+    if constexpr (IsHonkFlavor<Flavor>) {
+        for (auto [pkey_wire, trace_wire] : zip_view(proving_key->get_wires(), trace_data.wires)) {
+            pkey_wire = trace_wire.share();
+        }
+    } else if constexpr (IsPlonkFlavor<Flavor>) {
+        for (size_t idx = 0; idx < trace_data.wires.size(); ++idx) {
+            std::string wire_tag = "w_" + std::to_string(idx + 1) + "_lagrange";
+            proving_key->polynomial_store.put(wire_tag, std::move(trace_data.wires[idx]));
+        }
+    }
+}
+
 template <class Flavor>
 void ExecutionTrace_<Flavor>::add_wires_and_selectors_to_proving_key(
     TraceData& trace_data, Builder& builder, const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
@@ -67,7 +92,8 @@ void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(
 
 template <class Flavor>
 typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_trace_data(Builder& builder,
-                                                                                          size_t dyadic_circuit_size)
+                                                                                          size_t dyadic_circuit_size,
+                                                                                          bool is_structured)
 {
     TraceData trace_data{ dyadic_circuit_size, builder };
 
@@ -75,9 +101,17 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
     populate_public_inputs_block(builder);
 
     uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
+    if (offset > 0) {
+        trace_data.active_row_ranges.emplace_back(0, offset);
+    }
     // For each block in the trace, populate wire polys, copy cycles and selector polys
     for (auto& block : builder.blocks.get()) {
         auto block_size = static_cast<uint32_t>(block.size());
+        if (is_structured && block_size > block.fixed_size) {
+            throw_or_abort(
+                format("execution trace block of size ", block_size, " exceeds its fixed size ", block.fixed_size));
+        }
+        block.trace_offset = offset;
 
         // Update wire polynomials and copy cycles
         // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
@@ -107,7 +141,12 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
             trace_data.ram_rom_offset = offset;
         }
 
-        offset += block_size;
+        if (block_size > 0) {
+            trace_data.active_row_ranges.emplace_back(offset, offset + block_size);
+        }
+
+        // In a structured trace the unused capacity of the block is left empty
+        offset += is_structured ? block.fixed_size : block_size;
     }
     return trace_data;
 }
@@ -142,7 +181,7 @@ void ExecutionTrace_<Flavor>::add_ecc_op_wires_to_proving_key(
     Polynomial ecc_op_selector{ proving_key->circuit_size };
 
     // Copy the ecc op data from the conventional wires into the op wires over the range of ecc op gates
-    const size_t op_wire_offset = Flavor::has_zero_row ? 1 : 0;
+    const size_t op_wire_offset = builder.blocks.ecc_op.trace_offset;
     for (auto [ecc_op_wire, wire] : zip_view(op_wire_polynomials, proving_key->get_wires())) {
         for (size_t i = 0; i < builder.num_ecc_op_gates; ++i) {
             size_t idx = i + op_wire_offset;
@@ -23,6 +23,8 @@ template <class Flavor> class ExecutionTrace_ {
         std::vector<CyclicPermutation> copy_cycles;
         // The starting index in the trace of the block containing RAM/RAM read/write gates
         uint32_t ram_rom_offset = 0;
+        // The ranges [start, end) of trace rows covered by the (non-empty) blocks, including the zero row
+        std::vector<std::pair<size_t, size_t>> active_row_ranges;
 
         TraceData(size_t dyadic_circuit_size, Builder& builder)
         {
@@ -41,8 +43,18 @@ template <class Flavor> class ExecutionTrace_ {
      * @brief Given a circuit, populate a proving key with wire polys, selector polys, and sigma/id polys
      *
      * @param builder
+     * @param is_structured If true, each block is placed at the offset given by the fixed sizes of the preceding blocks
+     * (see TraceStructure)
      */
-    static void populate(Builder& builder, const std::shared_ptr<ProvingKey>&);
+    static void populate(Builder& builder, const std::shared_ptr<ProvingKey>&, bool is_structured = false);
+
+    /**
+     * @brief Given a circuit, populate a proving key with its wire polynomials only
+     * @details For proving keys whose precomputed polynomials were obtained elsewhere, e.g. read from a cache
+     *
+     * @param builder
+     */
+    static void populate_wires(Builder& builder, const std::shared_ptr<ProvingKey>&);
 
   private:
     /**
@@ -75,12 +87,14 @@ template <class Flavor> class ExecutionTrace_ {
 
     /**
      * @brief Construct wire polynomials, selector polynomials and copy cycles from raw circuit data
+     * @details Also sets the trace offset of each block
      *
      * @param builder
      * @param dyadic_circuit_size
+     * @param is_structured
      * @return TraceData
      */
-    static TraceData construct_trace_data(Builder& builder, size_t dyadic_circuit_size);
+    static TraceData construct_trace_data(Builder& builder, size_t dyadic_circuit_size, bool is_structured);
 
     /**
      * @brief Populate the public inputs block
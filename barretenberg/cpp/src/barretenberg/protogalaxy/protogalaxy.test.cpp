@@ -65,12 +65,13 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         return full_polynomials;
     }
 
+    template <size_t NUM_INSTANCES = 2>
     static std::tuple<std::shared_ptr<ProverInstance>, std::shared_ptr<VerifierInstance>> fold_and_verify(
         const std::vector<std::shared_ptr<ProverInstance>>& prover_instances,
         const std::vector<std::shared_ptr<VerifierInstance>>& verifier_instances)
     {
-        FoldingProver folding_prover(prover_instances);
-        FoldingVerifier folding_verifier(verifier_instances);
+        ProtoGalaxyProver_<ProverInstances_<Flavor, NUM_INSTANCES>> folding_prover(prover_instances);
+        ProtoGalaxyVerifier_<VerifierInstances_<Flavor, NUM_INSTANCES>> folding_verifier(verifier_instances);
 
         auto [prover_accumulator, folding_proof] = folding_prover.fold_instances();
         auto verifier_accumulator = folding_verifier.verify_folding_proof(folding_proof);
@@ -312,6 +313,11 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
             fold_and_verify({ prover_instance_1, prover_instance_2 }, { verifier_instance_1, verifier_instance_2 });
 
         check_accumulator_target_sum_manual(prover_accumulator, true);
+        // The evaluations cached by the prover for the next perturbator are those of the folded polynomials
+        EXPECT_EQ(prover_accumulator->full_honk_evaluations,
+                  ProtoGalaxyProver::compute_full_honk_evaluations(prover_accumulator->prover_polynomials,
+                                                                   prover_accumulator->alphas,
+                                                                   prover_accumulator->relation_parameters));
 
         auto builder_3 = typename Flavor::CircuitBuilder();
         construct_circuit(builder_3);
@@ -327,6 +333,43 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         decide_and_verify(prover_accumulator_2, verifier_accumulator_2, true);
     }
 
+    /**
+     * @brief Testing a fold of three fresh instances, then a fold of the accumulator with three more instances,
+     * followed by the decider.
+     *
+     */
+    static void test_full_protogalaxy_multiple_instances()
+    {
+        const auto construct_instances = [](size_t num_instances) {
+            std::vector<std::shared_ptr<ProverInstance>> prover_instances;
+            std::vector<std::shared_ptr<VerifierInstance>> verifier_instances;
+            for (size_t idx = 0; idx < num_instances; idx++) {
+                auto builder = typename Flavor::CircuitBuilder();
+                construct_circuit(builder);
+                auto prover_instance = std::make_shared<ProverInstance>(builder);
+                auto verification_key = std::make_shared<VerificationKey>(prover_instance->proving_key);
+                prover_instances.emplace_back(prover_instance);
+                verifier_instances.emplace_back(std::make_shared<VerifierInstance>(verification_key));
+            }
+            return std::make_pair(prover_instances, verifier_instances);
+        };
+
+        auto [prover_instances, verifier_instances] = construct_instances(3);
+        auto [prover_accumulator, verifier_accumulator] = fold_and_verify<3>(prover_instances, verifier_instances);
+        check_accumulator_target_sum_manual(prover_accumulator, true);
+        EXPECT_EQ(prover_accumulator->target_sum, verifier_accumulator->target_sum);
+
+        auto [prover_instances_2, verifier_instances_2] = construct_instances(3);
+        prover_instances_2.insert(prover_instances_2.begin(), prover_accumulator);
+        verifier_instances_2.insert(verifier_instances_2.begin(), verifier_accumulator);
+        auto [prover_accumulator_2, verifier_accumulator_2] =
+            fold_and_verify<4>(prover_instances_2, verifier_instances_2);
+        check_accumulator_target_sum_manual(prover_accumulator_2, true);
+        EXPECT_EQ(prover_accumulator_2->target_sum, verifier_accumulator_2->target_sum);
+
+        decide_and_verify(prover_accumulator_2, verifier_accumulator_2, true);
+    }
+
     /**
      * @brief Ensure tampering a commitment and then calling the decider causes the decider verification to fail.
      *
@@ -394,6 +437,8 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         auto verifier_instance_3 = std::make_shared<VerifierInstance>(verification_key_3);
 
         prover_accumulator->prover_polynomials.w_l[1] = FF::random_element();
+        // Drop the evaluations cached for the untampered polynomials, so that the prover evaluates the tampered ones
+        prover_accumulator->full_honk_evaluations.clear();
         auto [prover_accumulator_2, verifier_accumulator_2] =
             fold_and_verify({ prover_accumulator, prover_instance_3 }, { verifier_accumulator, verifier_instance_3 });
 
@@ -441,6 +486,11 @@ TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyTest)
     TestFixture::test_full_protogalaxy();
 }
 
+TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyMultipleInstances)
+{
+    TestFixture::test_full_protogalaxy_multiple_instances();
+}
+
 TYPED_TEST(ProtoGalaxyTests, TamperedCommitment)
 {
     TestFixture::test_tampered_commitment();
@@ -59,11 +59,9 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
 {
     auto combiner_quotient_at_challenge = combiner_quotient.evaluate(challenge);
 
-    // Given the challenge \gamma, compute Z(\gamma) and {L_0(\gamma),L_1(\gamma)}
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/764): Generalize the vanishing polynomial formula
-    // and the computation of Lagrange basis for k instances
-    auto vanishing_polynomial_at_challenge = challenge * (challenge - FF(1));
-    std::vector<FF> lagranges{ FF(1) - challenge, challenge };
+    // Given the challenge \gamma, compute Z(\gamma) and {L_0(\gamma), ..., L_{k-1}(\gamma)}
+    auto vanishing_polynomial_at_challenge = compute_vanishing_polynomial_at<FF, ProverInstances::NUM>(challenge);
+    auto lagranges = compute_lagrange_basis_at<FF, ProverInstances::NUM>(challenge);
 
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/881): bad pattern
     auto next_accumulator = std::make_shared<Instance>();
@@ -77,28 +75,6 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
     next_accumulator->target_sum = next_target_sum;
     next_accumulator->gate_challenges = instances.next_gate_challenges;
 
-    // Initialize prover polynomials
-    ProverPolynomials acc_prover_polynomials;
-    for (auto& polynomial : acc_prover_polynomials.get_all()) {
-        polynomial = typename Flavor::Polynomial(instances[0]->proving_key->circuit_size);
-    }
-
-    // Fold the prover polynomials
-    for (size_t inst_idx = 0; inst_idx < ProverInstances::NUM; inst_idx++) {
-        auto accumulator_polys = acc_prover_polynomials.get_all();
-        auto input_polys = instances[inst_idx]->prover_polynomials.get_all();
-        run_loop_in_parallel(Flavor::NUM_ALL_ENTITIES, [&](size_t start_idx, size_t end_idx) {
-            for (size_t poly_idx = start_idx; poly_idx < end_idx; poly_idx++) {
-                auto& acc_poly = accumulator_polys[poly_idx];
-                auto& inst_poly = input_polys[poly_idx];
-                for (auto [acc_el, inst_el] : zip_view(acc_poly, inst_poly)) {
-                    acc_el += inst_el * lagranges[inst_idx];
-                }
-            }
-        });
-    }
-    next_accumulator->prover_polynomials = std::move(acc_prover_polynomials);
-
     // Fold public data ϕ from all instances to produce ϕ* and add it to the transcript. As part of the folding
     // verification, the verifier will produce ϕ* as well and check it against what was sent by the prover.
 
@@ -135,6 +111,50 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
         combined_relation_parameters.lookup_grand_product_delta.evaluate(challenge),
     };
     next_accumulator->relation_parameters = folded_relation_parameters;
+
+    // Initialize prover polynomials
+    const size_t circuit_size = instances[0]->proving_key->circuit_size;
+    ProverPolynomials acc_prover_polynomials;
+    for (auto& polynomial : acc_prover_polynomials.get_all()) {
+        polynomial = typename Flavor::Polynomial(circuit_size);
+    }
+
+    // Fold the prover polynomials, writing each element of the accumulator once from the elements of all the instances.
+    // The rows are folded in blocks small enough to stay in cache while the full Honk relation is evaluated at them,
+    // which spares the perturbator of the next fold a separate pass over the accumulator.
+    constexpr size_t BLOCK_SIZE = 32;
+    auto accumulator_polys = acc_prover_polynomials.get_all();
+    const auto input_polys = instances.get_polynomials_views();
+    auto& full_honk_evaluations = next_accumulator->full_honk_evaluations;
+    full_honk_evaluations.resize(circuit_size);
+    const FF linearly_dependent_contribution =
+        parallel_reduce(circuit_size, FF(0), [&](size_t start_row, size_t end_row) {
+            auto thread_accumulator = FF(0);
+            for (size_t block_start = start_row; block_start < end_row; block_start += BLOCK_SIZE) {
+                const size_t block_end = std::min(block_start + BLOCK_SIZE, end_row);
+                for (size_t poly_idx = 0; poly_idx < Flavor::NUM_ALL_ENTITIES; poly_idx++) {
+                    auto& acc_poly = accumulator_polys[poly_idx];
+                    for (size_t row_idx = block_start; row_idx < block_end; row_idx++) {
+                        FF acc_el = input_polys[0][poly_idx][row_idx] * lagranges[0];
+                        for (size_t inst_idx = 1; inst_idx < ProverInstances::NUM; inst_idx++) {
+                            acc_el += input_polys[inst_idx][poly_idx][row_idx] * lagranges[inst_idx];
+                        }
+                        acc_poly[row_idx] = acc_el;
+                    }
+                }
+                for (size_t row_idx = block_start; row_idx < block_end; row_idx++) {
+                    full_honk_evaluations[row_idx] =
+                        compute_full_honk_evaluation(acc_prover_polynomials.get_row(row_idx),
+                                                     next_accumulator->alphas,
+                                                     next_accumulator->relation_parameters,
+                                                     thread_accumulator);
+                }
+            }
+            return thread_accumulator;
+        });
+    full_honk_evaluations[0] += linearly_dependent_contribution;
+    next_accumulator->prover_polynomials = std::move(acc_prover_polynomials);
+
     return next_accumulator;
 }
 
@@ -204,5 +224,9 @@ FoldingResult<typename ProverInstances::Flavor> ProtoGalaxyProver_<ProverInstanc
 }
 
 template class ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 2>>;
+template class ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 3>>;
+template class ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 4>>;
 template class ProtoGalaxyProver_<ProverInstances_<GoblinUltraFlavor, 2>>;
+template class ProtoGalaxyProver_<ProverInstances_<GoblinUltraFlavor, 3>>;
+template class ProtoGalaxyProver_<ProverInstances_<GoblinUltraFlavor, 4>>;
 } // namespace bb
\ No newline at end of file
@@ -57,6 +57,9 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
 
     using TupleOfTuplesOfUnivariates =
         typename Flavor::template ProtogalaxyTupleOfTuplesOfUnivariates<ProverInstances::NUM>;
+    // The per-thread accumulators of the combiner, which defer the reductions of the relations that support it
+    using TupleOfTuplesOfUnreducedUnivariates =
+        decltype(create_protogalaxy_tuple_of_tuples_of_unreduced_univariates<Relations, ProverInstances::NUM>());
     using RelationEvaluations = typename Flavor::TupleOfArraysOfValues;
 
     static constexpr size_t NUM_SUBRELATIONS = ProverInstances::NUM_SUBRELATIONS;
@@ -148,47 +151,46 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     {
         auto instance_size = instance_polynomials.get_polynomial_size();
         std::vector<FF> full_honk_evaluations(instance_size);
-        std::vector<FF> linearly_dependent_contributions(instance_size);
-#ifndef NO_MULTITHREADING
-        std::mutex evaluation_mutex;
-#endif
-        auto linearly_dependent_contribution_accumulator = FF(0);
-        run_loop_in_parallel(instance_size, [&](size_t start_row, size_t end_row) {
-            auto thread_accumulator = FF(0);
-            for (size_t row = start_row; row < end_row; row++) {
-                auto row_evaluations = instance_polynomials.get_row(row);
-                RelationEvaluations relation_evaluations;
-                Utils::zero_elements(relation_evaluations);
-
-                // Note that the evaluations are accumulated with the gate separation challenge
-                // being 1 at this stage, as this specific randomness is added later through the
-                // power polynomial univariate specific to ProtoGalaxy
-                Utils::template accumulate_relation_evaluations<>(
-                    row_evaluations, relation_evaluations, relation_parameters, FF(1));
-
-                auto output = FF(0);
-                auto running_challenge = FF(1);
-
-                // Sum relation evaluations, batched by their corresponding relation separator challenge, to
-                // get the value of the full honk relation at a specific row
-                auto linearly_dependent_contribution = FF(0);
-                Utils::scale_and_batch_elements(
-                    relation_evaluations, alpha, running_challenge, output, linearly_dependent_contribution);
-                thread_accumulator += linearly_dependent_contribution;
-
-                full_honk_evaluations[row] = output;
-            }
-            {
-#ifndef NO_MULTITHREADING
-                std::unique_lock<std::mutex> evaluation_lock(evaluation_mutex);
-#endif
-                linearly_dependent_contribution_accumulator += thread_accumulator;
-            }
-        });
+        const FF linearly_dependent_contribution_accumulator =
+            parallel_reduce(instance_size, FF(0), [&](size_t start_row, size_t end_row) {
+                auto thread_accumulator = FF(0);
+                for (size_t row = start_row; row < end_row; row++) {
+                    full_honk_evaluations[row] = compute_full_honk_evaluation(
+                        instance_polynomials.get_row(row), alpha, relation_parameters, thread_accumulator);
+                }
+                return thread_accumulator;
+            });
         full_honk_evaluations[0] += linearly_dependent_contribution_accumulator;
         return full_honk_evaluations;
     }
 
+    /**
+     * @brief Compute the value of the full Honk relation at a row, see compute_full_honk_evaluations. The contribution
+     * of the linearly dependent subrelations is added to linearly_dependent_contribution instead.
+     */
+    static FF compute_full_honk_evaluation(const RowEvaluations& row_evaluations,
+                                           const RelationSeparator& alpha,
+                                           const RelationParameters<FF>& relation_parameters,
+                                           FF& linearly_dependent_contribution)
+    {
+        RelationEvaluations relation_evaluations;
+        Utils::zero_elements(relation_evaluations);
+
+        // Note that the evaluations are accumulated with the gate separation challenge being 1 at this stage, as this
+        // specific randomness is added later through the power polynomial univariate specific to ProtoGalaxy
+        Utils::template accumulate_relation_evaluations<>(
+            row_evaluations, relation_evaluations, relation_parameters, FF(1));
+
+        auto output = FF(0);
+        auto running_challenge = FF(1);
+
+        // Sum relation evaluations, batched by their corresponding relation separator challenge, to get the value of
+        // the full honk relation at a specific row
+        Utils::scale_and_batch_elements(
+            relation_evaluations, alpha, running_challenge, output, linearly_dependent_contribution);
+        return output;
+    }
+
     /**
      * @brief  Recursively compute the parent nodes of each level in the tree, starting from the leaves. Note that at
      * each level, the resulting parent nodes will be polynomials of degree (level+1) because we multiply by an
@@ -247,15 +249,20 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     /**
      * @brief Construct the power perturbator polynomial F(X) in coefficient form from the accumulator, representing the
      * relaxed instance.
-     *
-     *
+     * @details An accumulator produced by compute_next_accumulator carries the values of the full Honk relation at
+     * each of its rows, evaluated while its polynomials were folded; they are only computed here otherwise.
      */
     static Polynomial<FF> compute_perturbator(const std::shared_ptr<Instance> accumulator,
                                               const std::vector<FF>& deltas)
     {
         BB_OP_COUNT_TIME();
-        auto full_honk_evaluations = compute_full_honk_evaluations(
-            accumulator->prover_polynomials, accumulator->alphas, accumulator->relation_parameters);
+        std::vector<FF> computed_evaluations;
+        if (accumulator->full_honk_evaluations.empty()) {
+            computed_evaluations = compute_full_honk_evaluations(
+                accumulator->prover_polynomials, accumulator->alphas, accumulator->relation_parameters);
+        }
+        const auto& full_honk_evaluations =
+            accumulator->full_honk_evaluations.empty() ? computed_evaluations : accumulator->full_honk_evaluations;
         const auto betas = accumulator->gate_challenges;
         assert(betas.size() == deltas.size());
         auto coeffs = construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
@@ -276,14 +283,25 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
                             const ProverInstances& instances,
                             const size_t row_idx)
     {
-        auto base_univariates = instances.row_to_univariates(row_idx);
+        extend_univariates(extended_univariates, instances.get_polynomials_views(), row_idx);
+    }
+
+    /**
+     * @brief As above, with the views of the instances' polynomials obtained once by the caller
+     */
+    template <typename PolynomialsViews>
+    static void extend_univariates(ExtendedUnivariates& extended_univariates,
+                                   const PolynomialsViews& instances_polynomials_views,
+                                   const size_t row_idx)
+    {
+        auto base_univariates = ProverInstances::row_to_univariates(instances_polynomials_views, row_idx);
         for (auto [extended_univariate, base_univariate] : zip_view(extended_univariates.get_all(), base_univariates)) {
             extended_univariate = base_univariate.template extend_to<ExtendedUnivariate::LENGTH>();
         }
     }
 
     template <typename Parameters, size_t relation_idx = 0>
-    void accumulate_relation_univariates(TupleOfTuplesOfUnivariates& univariate_accumulators,
+    void accumulate_relation_univariates(TupleOfTuplesOfUnreducedUnivariates& univariate_accumulators,
                                          const ExtendedUnivariates& extended_univariates,
                                          const Parameters& relation_parameters,
                                          const FF& scaling_factor)
@@ -319,7 +337,7 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         num_threads = num_threads > 0 ? num_threads : 1;                     // ensure num threads is >= 1
         size_t iterations_per_thread = common_instance_size / num_threads;   // actual iterations per thread
         // Construct univariate accumulator containers; one per thread
-        std::vector<TupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+        std::vector<TupleOfTuplesOfUnreducedUnivariates> thread_univariate_accumulators(num_threads);
         for (auto& accum : thread_univariate_accumulators) {
             // just normal relation lengths
             Utils::zero_univariates(accum);
@@ -329,6 +347,9 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         std::vector<ExtendedUnivariates> extended_univariates;
         extended_univariates.resize(num_threads);
 
+        // The polynomials of all instances, read at each row to build the univariates over the instances
+        const auto instances_polynomials_views = instances.get_polynomials_views();
+
         // Accumulate the contribution from each sub-relation
         parallel_for(num_threads, [&](size_t thread_idx) {
             size_t start = thread_idx * iterations_per_thread;
@@ -336,7 +357,7 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
 
             for (size_t idx = start; idx < end; idx++) {
                 // No need to initialise extended_univariates to 0, it's assigned to
-                extend_univariates(extended_univariates[thread_idx], instances, idx);
+                extend_univariates(extended_univariates[thread_idx], instances_polynomials_views, idx);
 
                 FF pow_challenge = pow_betas[idx];
 
@@ -351,9 +372,9 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
             }
         });
 
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
+        // Reduce the per-thread univariate accumulators and add them into a single set of accumulators
         for (auto& accumulators : thread_univariate_accumulators) {
-            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+            Utils::add_reduced_nested_tuples(univariate_accumulators, accumulators);
         }
         // Batch the univariate contributions from each sub-relation to obtain the round univariate
         return batch_over_relations(univariate_accumulators, instances.alphas);
@@ -382,25 +403,26 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
 
     /**
      * @brief Compute the combiner quotient defined as $K$ polynomial in the paper.
-     *
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/764): generalize the computation of vanishing
-     * polynomials and Lagrange basis and use batch_invert.
-     *
+     * @details K(X) = (G(X) - F(α) L_0(X)) / Z(X), evaluated at the points outside the folding domain {0, ..., k - 1},
+     * with L_0 the first Lagrange polynomial and Z the vanishing polynomial of the domain.
      */
     static Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, ProverInstances::NUM> compute_combiner_quotient(
         const FF compressed_perturbator, ExtendedUnivariateWithRandomization combiner)
     {
-        std::array<FF, ProverInstances::BATCHED_EXTENDED_LENGTH - ProverInstances::NUM> combiner_quotient_evals = {};
+        constexpr size_t NUM_QUOTIENT_EVALS = ProverInstances::BATCHED_EXTENDED_LENGTH - ProverInstances::NUM;
+        std::array<FF, NUM_QUOTIENT_EVALS> combiner_quotient_evals = {};
+        std::array<FF, NUM_QUOTIENT_EVALS> vanishing_polynomial_inverses;
 
         // Compute the combiner quotient polynomial as evaluations on points that are not in the vanishing set.
-        //
         for (size_t point = ProverInstances::NUM; point < combiner.size(); point++) {
             auto idx = point - ProverInstances::NUM;
-            auto lagrange_0 = FF(1) - FF(point);
-            auto vanishing_polynomial = FF(point) * (FF(point) - 1);
-
-            combiner_quotient_evals[idx] =
-                (combiner.value_at(point) - compressed_perturbator * lagrange_0) * vanishing_polynomial.invert();
+            auto lagrange_0 = compute_lagrange_basis_at<FF, ProverInstances::NUM>(FF(point))[0];
+            vanishing_polynomial_inverses[idx] = compute_vanishing_polynomial_at<FF, ProverInstances::NUM>(FF(point));
+            combiner_quotient_evals[idx] = combiner.value_at(point) - compressed_perturbator * lagrange_0;
+        }
+        FF::batch_invert(vanishing_polynomial_inverses);
+        for (size_t idx = 0; idx < NUM_QUOTIENT_EVALS; idx++) {
+            combiner_quotient_evals[idx] *= vanishing_polynomial_inverses[idx];
         }
 
         Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, ProverInstances::NUM> combiner_quotient(
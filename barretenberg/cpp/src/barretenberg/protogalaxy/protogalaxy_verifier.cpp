@@ -77,8 +77,9 @@ std::shared_ptr<typename VerifierInstances::Instance> ProtoGalaxyVerifier_<Verif
     FF combiner_challenge = transcript->template get_challenge<FF>("combiner_quotient_challenge");
     auto combiner_quotient_at_challenge = combiner_quotient.evaluate(combiner_challenge);
 
-    auto vanishing_polynomial_at_challenge = combiner_challenge * (combiner_challenge - FF(1));
-    auto lagranges = std::vector<FF>{ FF(1) - combiner_challenge, combiner_challenge };
+    auto vanishing_polynomial_at_challenge =
+        compute_vanishing_polynomial_at<FF, VerifierInstances::NUM>(combiner_challenge);
+    auto lagranges = compute_lagrange_basis_at<FF, VerifierInstances::NUM>(combiner_challenge);
 
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/881): bad pattern
     auto next_accumulator = std::make_shared<Instance>(accumulator->verification_key);
@@ -158,5 +159,9 @@ std::shared_ptr<typename VerifierInstances::Instance> ProtoGalaxyVerifier_<Verif
 }
 
 template class ProtoGalaxyVerifier_<VerifierInstances_<UltraFlavor, 2>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<UltraFlavor, 3>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<UltraFlavor, 4>>;
 template class ProtoGalaxyVerifier_<VerifierInstances_<GoblinUltraFlavor, 2>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<GoblinUltraFlavor, 3>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<GoblinUltraFlavor, 4>>;
 } // namespace bb
\ No newline at end of file
@@ -18,6 +18,7 @@ template <typename FF_> class AuxiliaryRelationImpl {
      *     5 // RAM consistency sub-relation 2
      *     5 // RAM consistency sub-relation 3
      * };
+    static constexpr bool SUPPORTS_UNREDUCED_ACCUMULATION = true;
      *
      * and
      *
@@ -40,6 +41,12 @@ template <typename FF_> class AuxiliaryRelationImpl {
         6  // RAM consistency sub-relation 3
     };
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in) { return in.q_aux.is_zero(); }
+
     static constexpr std::array<size_t, 6> TOTAL_LENGTH_ADJUSTMENTS{
         6, // auxiliary sub-relation
         6, // ROM consistency sub-relation 1
@@ -91,7 +98,7 @@ template <typename FF_> class AuxiliaryRelationImpl {
     {
 
         // All subrelations have the same length so we use the same length view for all calculations
-        using Accumulator = typename std::tuple_element_t<0, ContainerOverSubrelations>;
+        using Accumulator = SubrelationAccumulator<0, ContainerOverSubrelations>;
         using View = typename Accumulator::View;
         using ParameterView = GetParameterView<Parameters, View>;
 
@@ -249,11 +256,13 @@ template <typename FF_> class AuxiliaryRelationImpl {
 
         auto adjacent_values_match_if_adjacent_indices_match = (index_delta * FF(-1) + FF(1)) * record_delta; // deg 2
 
-        std::get<1>(accumulators) +=
-            adjacent_values_match_if_adjacent_indices_match * (q_1 * q_2) * (q_aux * scaling_factor); // deg 5
-        std::get<2>(accumulators) +=
-            index_is_monotonically_increasing * (q_1 * q_2) * (q_aux * scaling_factor); // deg 5
-        auto ROM_consistency_check_identity = memory_record_check * (q_1 * q_2);        // deg 3 or 7
+        accumulate_scaled(std::get<1>(accumulators),
+                          adjacent_values_match_if_adjacent_indices_match * (q_1 * q_2) * q_aux,
+                          scaling_factor); // deg 5
+        accumulate_scaled(std::get<2>(accumulators),
+                          index_is_monotonically_increasing * (q_1 * q_2) * q_aux,
+                          scaling_factor);                                       // deg 5
+        auto ROM_consistency_check_identity = memory_record_check * (q_1 * q_2); // deg 3 or 7
 
         /**
          * RAM Consistency Check
@@ -298,13 +307,16 @@ template <typename FF_> class AuxiliaryRelationImpl {
         auto next_gate_access_type_is_boolean = next_gate_access_type * next_gate_access_type - next_gate_access_type;
 
         // Putting it all together...
-        std::get<3>(accumulators) +=
-            adjacent_values_match_if_adjacent_indices_match_and_next_access_is_a_read_operation * (q_arith) *
-            (q_aux * scaling_factor); // deg 5 or 8
-        std::get<4>(accumulators) += index_is_monotonically_increasing * (q_arith) * (q_aux * scaling_factor); // deg 4
-        std::get<5>(accumulators) +=
-            next_gate_access_type_is_boolean * (q_arith) * (q_aux * scaling_factor); // deg 4 or 6
-        auto RAM_consistency_check_identity = access_check * (q_arith);              // deg 3 or 9
+        accumulate_scaled(std::get<3>(accumulators),
+                          adjacent_values_match_if_adjacent_indices_match_and_next_access_is_a_read_operation *
+                              (q_arith) * q_aux,
+                          scaling_factor); // deg 5 or 8
+        accumulate_scaled(
+            std::get<4>(accumulators), index_is_monotonically_increasing * (q_arith) * q_aux, scaling_factor); // deg 4
+        accumulate_scaled(std::get<5>(accumulators),
+                          next_gate_access_type_is_boolean * (q_arith) * q_aux,
+                          scaling_factor);                          // deg 4 or 6
+        auto RAM_consistency_check_identity = access_check * (q_arith); // deg 3 or 9
 
         /**
          * RAM Timestamp Consistency Check
@@ -331,8 +343,8 @@ template <typename FF_> class AuxiliaryRelationImpl {
 
         // (deg 3 or 9) + (deg 4) + (deg 3)
         auto auxiliary_identity = memory_identity + non_native_field_identity + limb_accumulator_identity;
-        auxiliary_identity *= (q_aux * scaling_factor); // deg 4 or 10
-        std::get<0>(accumulators) += auxiliary_identity;
+        auxiliary_identity *= q_aux; // deg 4 or 10
+        accumulate_scaled(std::get<0>(accumulators), auxiliary_identity, scaling_factor);
     };
 };
 
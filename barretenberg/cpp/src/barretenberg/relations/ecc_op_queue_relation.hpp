@@ -17,6 +17,7 @@ template <typename FF_> class EccOpQueueRelationImpl {
         3, // op-queue-wire vanishes sub-relation 3
         3  // op-queue-wire vanishes sub-relation 4
     };
+    static constexpr bool SUPPORTS_UNREDUCED_ACCUMULATION = true;
 
     /**
      * @brief Expression for the generalized permutation sort gate.
@@ -43,7 +44,7 @@ template <typename FF_> class EccOpQueueRelationImpl {
                                   const Parameters&,
                                   const FF& scaling_factor)
     {
-        using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+        using Accumulator = SubrelationAccumulator<0, ContainerOverSubrelations>;
         using View = typename Accumulator::View;
 
         auto w_1 = View(in.w_l);
@@ -62,46 +63,38 @@ template <typename FF_> class EccOpQueueRelationImpl {
         // Contribution (1)
         auto tmp = op_wire_1 - w_1;
         tmp *= lagrange_ecc_op;
-        tmp *= scaling_factor;
-        std::get<0>(accumulators) += tmp;
+        accumulate_scaled(std::get<0>(accumulators), tmp, scaling_factor);
 
         // Contribution (2)
         tmp = op_wire_2 - w_2;
         tmp *= lagrange_ecc_op;
-        tmp *= scaling_factor;
-        std::get<1>(accumulators) += tmp;
+        accumulate_scaled(std::get<1>(accumulators), tmp, scaling_factor);
 
         // Contribution (3)
         tmp = op_wire_3 - w_3;
         tmp *= lagrange_ecc_op;
-        tmp *= scaling_factor;
-        std::get<2>(accumulators) += tmp;
+        accumulate_scaled(std::get<2>(accumulators), tmp, scaling_factor);
 
         // Contribution (4)
         tmp = op_wire_4 - w_4;
         tmp *= lagrange_ecc_op;
-        tmp *= scaling_factor;
-        std::get<3>(accumulators) += tmp;
+        accumulate_scaled(std::get<3>(accumulators), tmp, scaling_factor);
 
         // Contribution (5)
         tmp = op_wire_1 * complement_ecc_op;
-        tmp *= scaling_factor;
-        std::get<4>(accumulators) += tmp;
+        accumulate_scaled(std::get<4>(accumulators), tmp, scaling_factor);
 
         // Contribution (6)
         tmp = op_wire_2 * complement_ecc_op;
-        tmp *= scaling_factor;
-        std::get<5>(accumulators) += tmp;
+        accumulate_scaled(std::get<5>(accumulators), tmp, scaling_factor);
 
         // Contribution (7)
         tmp = op_wire_3 * complement_ecc_op;
-        tmp *= scaling_factor;
-        std::get<6>(accumulators) += tmp;
+        accumulate_scaled(std::get<6>(accumulators), tmp, scaling_factor);
 
         // Contribution (8)
         tmp = op_wire_4 * complement_ecc_op;
-        tmp *= scaling_factor;
-        std::get<7>(accumulators) += tmp;
+        accumulate_scaled(std::get<7>(accumulators), tmp, scaling_factor);
     };
 };
 
@@ -13,6 +13,13 @@ template <typename FF_> class EllipticRelationImpl {
         6, // x-coordinate sub-relation
         6, // y-coordinate sub-relation
     };
+    static constexpr bool SUPPORTS_UNREDUCED_ACCUMULATION = true;
+
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in) { return in.q_elliptic.is_zero(); }
 
     // TODO(@zac-williamson #2609 find more generic way of doing this)
     static constexpr FF get_curve_b()
@@ -46,7 +53,7 @@ template <typename FF_> class EllipticRelationImpl {
         // replace old addition relations with these ones and
         // remove endomorphism coefficient in ecc add gate(not used))
 
-        using Accumulator = typename std::tuple_element_t<0, ContainerOverSubrelations>;
+        using Accumulator = SubrelationAccumulator<0, ContainerOverSubrelations>;
         using View = typename Accumulator::View;
         auto x_1 = View(in.w_r);
         auto y_1 = View(in.w_o);
@@ -67,14 +74,14 @@ template <typename FF_> class EllipticRelationImpl {
         auto y1_sqr = (y_1 * y_1);
         auto y1y2 = y_1 * y_2 * q_sign;
         auto x_add_identity = (x_3 + x_2 + x_1) * x_diff * x_diff - y2_sqr - y1_sqr + y1y2 + y1y2;
-        std::get<0>(accumulators) += x_add_identity * scaling_factor * q_elliptic * (-q_is_double + 1);
+        accumulate_scaled(std::get<0>(accumulators), x_add_identity * q_elliptic * (-q_is_double + 1), scaling_factor);
 
         // Contribution (2) point addition, x-coordinate check
         // q_elliptic * (q_sign * y1 + y3)(x2 - x1) + (x3 - x1)(y2 - q_sign * y1) = 0
         auto y1_plus_y3 = y_1 + y_3;
         auto y_diff = y_2 * q_sign - y_1;
         auto y_add_identity = y1_plus_y3 * x_diff + (x_3 - x_1) * y_diff;
-        std::get<1>(accumulators) += y_add_identity * scaling_factor * q_elliptic * (-q_is_double + 1);
+        accumulate_scaled(std::get<1>(accumulators), y_add_identity * q_elliptic * (-q_is_double + 1), scaling_factor);
 
         // Contribution (3) point doubling, x-coordinate check
         // (x3 + x1 + x1) (4y1*y1) - 9 * x1 * x1 * x1 * x1 = 0
@@ -85,13 +92,13 @@ template <typename FF_> class EllipticRelationImpl {
         y1_sqr_mul_4 += y1_sqr_mul_4;
         auto x1_pow_4_mul_9 = x_pow_4 * 9;
         auto x_double_identity = (x_3 + x_1 + x_1) * y1_sqr_mul_4 - x1_pow_4_mul_9;
-        std::get<0>(accumulators) += x_double_identity * scaling_factor * q_elliptic * q_is_double;
+        accumulate_scaled(std::get<0>(accumulators), x_double_identity * q_elliptic * q_is_double, scaling_factor);
 
         // Contribution (4) point doubling, y-coordinate check
         // (y1 + y1) (2y1) - (3 * x1 * x1)(x1 - x3) = 0
         auto x1_sqr_mul_3 = (x_1 + x_1 + x_1) * x_1;
         auto y_double_identity = x1_sqr_mul_3 * (x_1 - x_3) - (y_1 + y_1) * (y_1 + y_3);
-        std::get<1>(accumulators) += y_double_identity * scaling_factor * q_elliptic * q_is_double;
+        accumulate_scaled(std::get<1>(accumulators), y_double_identity * q_elliptic * q_is_double, scaling_factor);
     };
 };
 
@@ -13,6 +13,13 @@ template <typename FF_> class GenPermSortRelationImpl {
         6, // range constrain sub-relation 3
         6  // range constrain sub-relation 4
     };
+    static constexpr bool SUPPORTS_UNREDUCED_ACCUMULATION = true;
+
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in) { return in.q_sort.is_zero(); }
 
     /**
      * @brief Expression for the generalized permutation sort gate.
@@ -35,7 +42,7 @@ template <typename FF_> class GenPermSortRelationImpl {
                                   const Parameters&,
                                   const FF& scaling_factor)
     {
-        using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+        using Accumulator = SubrelationAccumulator<0, ContainerOverSubrelations>;
         using View = typename Accumulator::View;
         auto w_1 = View(in.w_l);
         auto w_2 = View(in.w_r);
@@ -60,8 +67,7 @@ template <typename FF_> class GenPermSortRelationImpl {
         tmp_1 *= (delta_1 + minus_two);
         tmp_1 *= (delta_1 + minus_three);
         tmp_1 *= q_sort;
-        tmp_1 *= scaling_factor;
-        std::get<0>(accumulators) += tmp_1;
+        accumulate_scaled(std::get<0>(accumulators), tmp_1, scaling_factor);
 
         // Contribution (2)
         auto tmp_2 = delta_2;
@@ -69,8 +75,7 @@ template <typename FF_> class GenPermSortRelationImpl {
         tmp_2 *= (delta_2 + minus_two);
         tmp_2 *= (delta_2 + minus_three);
         tmp_2 *= q_sort;
-        tmp_2 *= scaling_factor;
-        std::get<1>(accumulators) += tmp_2;
+        accumulate_scaled(std::get<1>(accumulators), tmp_2, scaling_factor);
 
         // Contribution (3)
         auto tmp_3 = delta_3;
@@ -78,8 +83,7 @@ template <typename FF_> class GenPermSortRelationImpl {
         tmp_3 *= (delta_3 + minus_two);
         tmp_3 *= (delta_3 + minus_three);
         tmp_3 *= q_sort;
-        tmp_3 *= scaling_factor;
-        std::get<2>(accumulators) += tmp_3;
+        accumulate_scaled(std::get<2>(accumulators), tmp_3, scaling_factor);
 
         // Contribution (4)
         auto tmp_4 = delta_4;
@@ -87,8 +91,7 @@ template <typename FF_> class GenPermSortRelationImpl {
         tmp_4 *= (delta_4 + minus_two);
         tmp_4 *= (delta_4 + minus_three);
         tmp_4 *= q_sort;
-        tmp_4 *= scaling_factor;
-        std::get<3>(accumulators) += tmp_4;
+        accumulate_scaled(std::get<3>(accumulators), tmp_4, scaling_factor);
     };
 };
 
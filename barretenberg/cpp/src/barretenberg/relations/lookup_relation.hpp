@@ -26,6 +26,7 @@ template <typename FF_> class LookupRelationImpl {
         6, // grand product construction sub-relation
         3  // left-shiftable polynomial sub-relation
     };
+    static constexpr bool SUPPORTS_UNREDUCED_ACCUMULATION = true;
 
     static constexpr std::array<size_t, 2> TOTAL_LENGTH_ADJUSTMENTS{
         6, // grand product construction sub-relation
@@ -174,7 +175,7 @@ template <typename FF_> class LookupRelationImpl {
     {
 
         {
-            using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+            using Accumulator = SubrelationAccumulator<0, ContainerOverSubrelations>;
             using View = typename Accumulator::View;
             using ParameterView = GetParameterView<Parameters, View>;
 
@@ -190,19 +191,18 @@ template <typename FF_> class LookupRelationImpl {
             const auto rhs = compute_grand_product_denominator<Accumulator>(in, params); // deg 1 or 2
 
             // (deg 5 or 11) - (deg 3 or 5)
-            const auto tmp =
-                lhs * (z_lookup + lagrange_first) - rhs * (z_lookup_shift + lagrange_last * grand_product_delta);
-            std::get<0>(accumulators) += tmp * scaling_factor;
+            auto tmp = lhs * (z_lookup + lagrange_first) - rhs * (z_lookup_shift + lagrange_last * grand_product_delta);
+            accumulate_scaled(std::get<0>(accumulators), tmp, scaling_factor);
         };
 
         {
-            using Accumulator = std::tuple_element_t<1, ContainerOverSubrelations>;
+            using Accumulator = SubrelationAccumulator<1, ContainerOverSubrelations>;
             using View = typename Accumulator::View;
             auto z_lookup_shift = View(in.z_lookup_shift);
             auto lagrange_last = View(in.lagrange_last);
 
             // Contribution (2)
-            std::get<1>(accumulators) += (lagrange_last * z_lookup_shift) * scaling_factor;
+            accumulate_scaled(std::get<1>(accumulators), lagrange_last * z_lookup_shift, scaling_factor);
         };
     };
 };
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/polynomials/univariate.hpp"
+#include "barretenberg/polynomials/unreduced_univariate.hpp"
 #include <tuple>
 
 namespace bb {
@@ -35,6 +36,9 @@ using HomogeneousTupleToArray = std::array<std::tuple_element_t<0, Tuple>, std::
 template <typename FF, auto LENGTHS>
 using TupleOfUnivariates = typename TupleOfContainersOverArray<bb::Univariate, FF, LENGTHS, 0>::type;
 
+template <typename FF, auto LENGTHS>
+using TupleOfUnreducedUnivariates = typename TupleOfContainersOverArray<bb::UnreducedUnivariate, FF, LENGTHS, 0>::type;
+
 template <typename FF, auto LENGTHS>
 using TupleOfValues = typename TupleOfContainersOverArray<ExtractValueType, FF, LENGTHS>::type;
 
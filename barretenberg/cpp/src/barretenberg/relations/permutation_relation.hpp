@@ -11,6 +11,7 @@ template <typename FF_> class UltraPermutationRelationImpl {
         6, // grand product construction sub-relation
         3  // left-shiftable polynomial sub-relation
     };
+    static constexpr bool SUPPORTS_UNREDUCED_ACCUMULATION = true;
 
     static constexpr std::array<size_t, 2> TOTAL_LENGTH_ADJUSTMENTS{
         5, // grand product construction sub-relation
@@ -86,7 +87,7 @@ template <typename FF_> class UltraPermutationRelationImpl {
     {
         // Contribution (1)
         [&]() {
-            using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+            using Accumulator = SubrelationAccumulator<0, ContainerOverSubrelations>;
             using View = typename Accumulator::View;
             using ParameterView = GetParameterView<Parameters, View>;
             const auto public_input_delta = ParameterView(params.public_input_delta);
@@ -97,21 +98,21 @@ template <typename FF_> class UltraPermutationRelationImpl {
 
             // witness degree: deg 5 - deg 5 = deg 5
             // total degree: deg 9 - deg 10 = deg 10
-            std::get<0>(accumulators) +=
-                (((z_perm + lagrange_first) * compute_grand_product_numerator<Accumulator>(in, params)) -
-                 ((z_perm_shift + lagrange_last * public_input_delta) *
-                  compute_grand_product_denominator<Accumulator>(in, params))) *
-                scaling_factor;
+            accumulate_scaled(std::get<0>(accumulators),
+                              ((z_perm + lagrange_first) * compute_grand_product_numerator<Accumulator>(in, params)) -
+                                  ((z_perm_shift + lagrange_last * public_input_delta) *
+                                   compute_grand_product_denominator<Accumulator>(in, params)),
+                              scaling_factor);
         }();
 
         // Contribution (2)
         [&]() {
-            using Accumulator = std::tuple_element_t<1, ContainerOverSubrelations>;
+            using Accumulator = SubrelationAccumulator<1, ContainerOverSubrelations>;
             using View = typename Accumulator::View;
             auto z_perm_shift = View(in.z_perm_shift);
             auto lagrange_last = View(in.lagrange_last);
 
-            std::get<1>(accumulators) += (lagrange_last * z_perm_shift) * scaling_factor;
+            accumulate_scaled(std::get<1>(accumulators), lagrange_last * z_perm_shift, scaling_factor);
         }();
     };
 };
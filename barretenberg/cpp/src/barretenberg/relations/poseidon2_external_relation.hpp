@@ -12,6 +12,16 @@ template <typename FF_> class Poseidon2ExternalRelationImpl {
         7, // external poseidon2 round sub-relation for third value
         7, // external poseidon2 round sub-relation for fourth value
     };
+    static constexpr bool SUPPORTS_UNREDUCED_ACCUMULATION = true;
+
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in)
+    {
+        return in.q_poseidon2_external.is_zero();
+    }
 
     /**
      * @brief Expression for the poseidon2 external round relation, based on E_i in Section 6 of
@@ -43,7 +53,7 @@ template <typename FF_> class Poseidon2ExternalRelationImpl {
                            const Parameters&,
                            const FF& scaling_factor)
     {
-        using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+        using Accumulator = SubrelationAccumulator<0, ContainerOverSubrelations>;
         using View = typename Accumulator::View;
         auto w_l = View(in.w_l);
         auto w_r = View(in.w_r);
@@ -96,20 +106,16 @@ template <typename FF_> class Poseidon2ExternalRelationImpl {
         auto v3 = t2 + v4; // u_1 + 3u_2 + 5u_3 + 7u_4
 
         auto tmp = q_poseidon2_external * (v1 - w_l_shift);
-        tmp *= scaling_factor;
-        std::get<0>(evals) += tmp;
+        accumulate_scaled(std::get<0>(evals), tmp, scaling_factor);
 
         tmp = q_poseidon2_external * (v2 - w_r_shift);
-        tmp *= scaling_factor;
-        std::get<1>(evals) += tmp;
+        accumulate_scaled(std::get<1>(evals), tmp, scaling_factor);
 
         tmp = q_poseidon2_external * (v3 - w_o_shift);
-        tmp *= scaling_factor;
-        std::get<2>(evals) += tmp;
+        accumulate_scaled(std::get<2>(evals), tmp, scaling_factor);
 
         tmp = q_poseidon2_external * (v4 - w_4_shift);
-        tmp *= scaling_factor;
-        std::get<3>(evals) += tmp;
+        accumulate_scaled(std::get<3>(evals), tmp, scaling_factor);
     };
 };
 
@@ -14,6 +14,16 @@ template <typename FF_> class Poseidon2InternalRelationImpl {
         7, // internal poseidon2 round sub-relation for third value
         7, // internal poseidon2 round sub-relation for fourth value
     };
+    static constexpr bool SUPPORTS_UNREDUCED_ACCUMULATION = true;
+
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in)
+    {
+        return in.q_poseidon2_internal.is_zero();
+    }
 
     /**
      * @brief Expression for the poseidon2 internal round relation, based on I_i in Section 6 of
@@ -40,7 +50,7 @@ template <typename FF_> class Poseidon2InternalRelationImpl {
                            const Parameters&,
                            const FF& scaling_factor)
     {
-        using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+        using Accumulator = SubrelationAccumulator<0, ContainerOverSubrelations>;
         using View = typename Accumulator::View;
         auto w_l = View(in.w_l);
         auto w_r = View(in.w_r);
@@ -70,26 +80,22 @@ template <typename FF_> class Poseidon2InternalRelationImpl {
         auto v1 = u1 * crypto::Poseidon2Bn254ScalarFieldParams::internal_matrix_diagonal[0];
         v1 += sum;
         auto tmp = q_poseidon2_internal * (v1 - w_l_shift);
-        tmp *= scaling_factor;
-        std::get<0>(evals) += tmp;
+        accumulate_scaled(std::get<0>(evals), tmp, scaling_factor);
 
         auto v2 = u2 * crypto::Poseidon2Bn254ScalarFieldParams::internal_matrix_diagonal[1];
         v2 += sum;
         tmp = q_poseidon2_internal * (v2 - w_r_shift);
-        tmp *= scaling_factor;
-        std::get<1>(evals) += tmp;
+        accumulate_scaled(std::get<1>(evals), tmp, scaling_factor);
 
         auto v3 = u3 * crypto::Poseidon2Bn254ScalarFieldParams::internal_matrix_diagonal[2];
         v3 += sum;
         tmp = q_poseidon2_internal * (v3 - w_o_shift);
-        tmp *= scaling_factor;
-        std::get<2>(evals) += tmp;
+        accumulate_scaled(std::get<2>(evals), tmp, scaling_factor);
 
         auto v4 = u4 * crypto::Poseidon2Bn254ScalarFieldParams::internal_matrix_diagonal[3];
         v4 += sum;
         tmp = q_poseidon2_internal * (v4 - w_4_shift);
-        tmp *= scaling_factor;
-        std::get<3>(evals) += tmp;
+        accumulate_scaled(std::get<3>(evals), tmp, scaling_factor);
     };
 }; // namespace bb
 
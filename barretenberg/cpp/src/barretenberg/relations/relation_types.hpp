@@ -31,6 +31,61 @@ concept HasSubrelationLinearlyIndependentMember = requires(T) {
 template <typename T>
 concept HasParameterLengthAdjustmentsMember = requires { T::TOTAL_LENGTH_ADJUSTMENTS; };
 
+/**
+ * @brief Check whether a relation can cheaply determine that its contribution on a given input is zero.
+ *
+ * @details Relations whose subrelations are all scaled by the same selector implement `skip`, which returns true when
+ * that selector vanishes on the input. The sumcheck prover uses this to avoid accumulating relations on rows outside
+ * of the execution trace block the relation is active in.
+ */
+template <typename Relation, typename AllEntities>
+concept isSkippable = requires(const AllEntities& input) {
+                          {
+                              Relation::skip(input)
+                              } -> std::same_as<bool>;
+                      };
+
+/**
+ * @brief Check whether a relation supports accumulating into UnreducedUnivariates.
+ *
+ * @details Such a relation computes its contributions in SubrelationAccumulator types and adds them with
+ * accumulate_scaled. The provers then accumulate it into UnreducedUnivariates, which defer the reductions of the
+ * products by the scaling factor to a single reduction per thread.
+ */
+template <typename Relation>
+concept supportsUnreducedAccumulation = Relation::SUPPORTS_UNREDUCED_ACCUMULATION;
+
+template <typename Accumulator> struct ReducedAccumulator {
+    using type = Accumulator;
+};
+template <typename Accumulator>
+    requires requires { typename Accumulator::Reduced; }
+struct ReducedAccumulator<Accumulator> {
+    using type = typename Accumulator::Reduced;
+};
+
+/**
+ * @brief The type in which a relation computes the contribution of a subrelation to a container of accumulators: the
+ * accumulator type itself, or the Univariate of an UnreducedUnivariate.
+ */
+template <size_t subrelation_idx, typename ContainerOverSubrelations>
+using SubrelationAccumulator =
+    typename ReducedAccumulator<std::tuple_element_t<subrelation_idx, ContainerOverSubrelations>>::type;
+
+/**
+ * @brief Add contribution * scaling_factor to the accumulator of a subrelation; contribution may be overwritten.
+ */
+template <typename Accumulator, typename Contribution, typename FF>
+inline void accumulate_scaled(Accumulator& accumulator, Contribution&& contribution, const FF& scaling_factor)
+{
+    if constexpr (requires { accumulator.add_scaled(contribution, scaling_factor); }) {
+        accumulator.add_scaled(contribution, scaling_factor);
+    } else {
+        contribution *= scaling_factor;
+        accumulator += contribution;
+    }
+}
+
 /**
  * @brief Check whether a given subrelation is linearly independent from the other subrelations.
  *
@@ -136,6 +191,18 @@ template <typename RelationImpl> class Relation : public RelationImpl {
         TupleOfUnivariates<FF, compute_composed_subrelation_partial_lengths<NUM_INSTANCES>(SUBRELATION_TOTAL_LENGTHS)>;
     using SumcheckTupleOfUnivariatesOverSubrelations =
         TupleOfUnivariates<FF, RelationImpl::SUBRELATION_PARTIAL_LENGTHS>;
+    // The accumulators of the provers: UnreducedUnivariates if the relation supports them, Univariates otherwise
+    template <size_t NUM_INSTANCES>
+    using ProtogalaxyTupleOfUnreducedUnivariatesOverSubrelations =
+        std::conditional_t<supportsUnreducedAccumulation<RelationImpl>,
+                           TupleOfUnreducedUnivariates<FF,
+                                                       compute_composed_subrelation_partial_lengths<NUM_INSTANCES>(
+                                                           SUBRELATION_TOTAL_LENGTHS)>,
+                           ProtogalaxyTupleOfUnivariatesOverSubrelations<NUM_INSTANCES>>;
+    using SumcheckTupleOfUnreducedUnivariatesOverSubrelations =
+        std::conditional_t<supportsUnreducedAccumulation<RelationImpl>,
+                           TupleOfUnreducedUnivariates<FF, RelationImpl::SUBRELATION_PARTIAL_LENGTHS>,
+                           SumcheckTupleOfUnivariatesOverSubrelations>;
     using SumcheckArrayOfValuesOverSubrelations = ArrayOfValues<FF, RelationImpl::SUBRELATION_PARTIAL_LENGTHS>;
 
     // These are commonly needed, most importantly, for explicitly instantiating
@@ -11,6 +11,13 @@ template <typename FF_> class UltraArithmeticRelationImpl {
         6, // primary arithmetic sub-relation
         5  // secondary arithmetic sub-relation
     };
+    static constexpr bool SUPPORTS_UNREDUCED_ACCUMULATION = true;
+
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in) { return in.q_arith.is_zero(); }
 
     /**
      * @brief Expression for the Ultra Arithmetic gate.
@@ -70,7 +77,7 @@ template <typename FF_> class UltraArithmeticRelationImpl {
                                   const FF& scaling_factor)
     {
         {
-            using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+            using Accumulator = SubrelationAccumulator<0, ContainerOverSubrelations>;
             using View = typename Accumulator::View;
             auto w_l = View(in.w_l);
             auto w_r = View(in.w_r);
@@ -91,11 +98,10 @@ template <typename FF_> class UltraArithmeticRelationImpl {
             tmp += (q_l * w_l) + (q_r * w_r) + (q_o * w_o) + (q_4 * w_4) + q_c;
             tmp += (q_arith - 1) * w_4_shift;
             tmp *= q_arith;
-            tmp *= scaling_factor;
-            std::get<0>(evals) += tmp;
+            accumulate_scaled(std::get<0>(evals), tmp, scaling_factor);
         }
         {
-            using Accumulator = std::tuple_element_t<1, ContainerOverSubrelations>;
+            using Accumulator = SubrelationAccumulator<1, ContainerOverSubrelations>;
             using View = typename Accumulator::View;
             auto w_l = View(in.w_l);
             auto w_4 = View(in.w_4);
@@ -107,8 +113,7 @@ template <typename FF_> class UltraArithmeticRelationImpl {
             tmp *= (q_arith - 2);
             tmp *= (q_arith - 1);
             tmp *= q_arith;
-            tmp *= scaling_factor;
-            std::get<1>(evals) += tmp;
+            accumulate_scaled(std::get<1>(evals), tmp, scaling_factor);
         };
     };
 };
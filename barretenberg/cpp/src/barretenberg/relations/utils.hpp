@@ -141,6 +141,27 @@ template <typename Flavor> class RelationUtils {
         }
     }
 
+    /**
+     * @brief Componentwise addition of nested tuples of accumulators, some of which may be UnreducedUnivariates, to
+     * nested tuples of the corresponding Univariates
+     *
+     * @param tuple_1 Nested tuple of Univariates. Result stored here
+     * @param tuple_2 Nested tuple of Univariates and UnreducedUnivariates, which are reduced before being added
+     */
+    template <typename Tuple, typename UnreducedTuple>
+    static void add_reduced_nested_tuples(Tuple& tuple_1, const UnreducedTuple& tuple_2)
+    {
+        auto add_reduced = [&]<size_t outer_idx, size_t inner_idx>(auto& element) {
+            const auto& summand = std::get<inner_idx>(std::get<outer_idx>(tuple_2));
+            if constexpr (requires { summand.reduce(); }) {
+                element += summand.reduce();
+            } else {
+                element += summand;
+            }
+        };
+        apply_to_tuple_of_tuples(tuple_1, add_reduced);
+    }
+
     /**
      * @brief Calculate the contribution of each relation to the expected value of the full Honk relation.
      *
@@ -4,6 +4,7 @@
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base.hpp"
 #include <cstddef>
 
 namespace bb::pairing {
@@ -25,6 +26,16 @@ template <typename Curve> class ProverCrs {
      */
     virtual typename Curve::AffineElement* get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
+
+    /**
+     * @brief Returns `num_tables` shifted copies of the monomial points, for use with the fixed-base pippenger
+     * algorithm (see fixed_base.hpp). The default implementation computes them in memory on each call.
+     */
+    virtual scalar_multiplication::fixed_base_point_table<Curve> get_fixed_base_point_table(size_t num_tables)
+    {
+        return scalar_multiplication::compute_fixed_base_point_table<Curve>(
+            get_monomial_points(), get_monomial_size(), num_tables);
+    }
 };
 
 template <typename Curve> class VerifierCrs {
@@ -1,5 +1,7 @@
 #include "file_crs_factory.hpp"
 #include "../io.hpp"
+#include "../mapped_file.hpp"
+#include "barretenberg/common/log.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
@@ -7,18 +9,184 @@
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
 namespace bb::srs::factories {
 
+namespace {
+/**
+ * Header of a fixed-base table file. It is followed by the tables, as laid out in memory (i.e. native endianness,
+ * montgomery form). The header is padded so the points are cache line aligned in the mapping.
+ */
+struct alignas(64) FixedBaseTableHeader {
+    std::array<char, 8> magic;
+    uint64_t num_points;
+    uint64_t num_tables;
+    uint64_t bits_per_bucket;
+    uint64_t point_size;
+};
+
+constexpr std::array<char, 8> FIXED_BASE_TABLE_MAGIC = { 'b', 'b', 'f', 'i', 'x', 'e', 'd', '1' };
+
+/**
+ * Header of a native CRS file, see get_native_crs_path. It is itself in native endianness, so a file produced on a
+ * machine of different endianness fails validation and the transcripts are used instead.
+ */
+struct alignas(64) NativeCrsHeader {
+    std::array<char, 8> magic;
+    uint64_t num_points;
+    uint64_t point_size;
+    // sizeof(G2AffineElement) for curves with a G2, in which case g2_x holds [x]_2 as laid out in memory
+    uint64_t g2_size;
+    std::array<uint8_t, 128> g2_x;
+};
+
+constexpr std::array<char, 8> NATIVE_CRS_MAGIC = { 'b', 'b', 'n', 'a', 't', 'i', 'v', '1' };
+
+template <typename Curve> constexpr size_t get_g2_size()
+{
+    if constexpr (HasG2<Curve>) {
+        static_assert(sizeof(typename Curve::G2AffineElement) <= sizeof(NativeCrsHeader::g2_x));
+        return sizeof(typename Curve::G2AffineElement);
+    } else {
+        return 0;
+    }
+}
+
+/**
+ * Writes a header followed by the data to a temporary file and renames it, so that concurrent provers never map a
+ * partially written file.
+ */
+bool write_file_atomically(
+    std::string const& path, void const* header, size_t header_size, void const* data, size_t data_size)
+{
+    const std::string temp_path = format(path, ".", reinterpret_cast<uintptr_t>(data), ".tmp");
+    std::ofstream file(temp_path, std::ios::binary);
+    file.write(static_cast<const char*>(header), static_cast<std::streamsize>(header_size));
+    file.write(static_cast<const char*>(data), static_cast<std::streamsize>(data_size));
+    file.close();
+    if (!file || std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Maps the native CRS file in `dir` and returns its pippenger point table, or nullptr if there is no usable file with
+ * at least `num_points` points.
+ */
+template <typename Curve>
+std::shared_ptr<typename Curve::AffineElement[]> map_native_crs(std::string const& dir,
+                                                                size_t num_points,
+                                                                NativeCrsHeader& header)
+{
+    using AffineElement = typename Curve::AffineElement;
+    size_t file_size = 0;
+    auto mapping = map_file_read_only(get_native_crs_path(dir), file_size);
+    if (!mapping || file_size < sizeof(NativeCrsHeader)) {
+        return nullptr;
+    }
+    memcpy(&header, mapping.get(), sizeof(header));
+    if (header.magic != NATIVE_CRS_MAGIC || header.point_size != sizeof(AffineElement) ||
+        header.g2_size != get_g2_size<Curve>() || header.num_points < num_points ||
+        file_size != sizeof(header) + header.num_points * 2 * sizeof(AffineElement)) {
+        return nullptr;
+    }
+    auto* points = reinterpret_cast<AffineElement*>(static_cast<char*>(mapping.get()) + sizeof(header));
+    // Catches a file written for the other curve
+    if (header.num_points > 0 && !points[0].on_curve()) {
+        return nullptr;
+    }
+    // Alias the mapping so that it stays alive as long as the points do
+    return std::shared_ptr<AffineElement[]>(mapping, points);
+}
+
+template <typename Curve>
+void write_native_crs_file(std::string const& dir,
+                           std::span<const typename Curve::AffineElement> points,
+                           NativeCrsHeader& header)
+{
+    using AffineElement = typename Curve::AffineElement;
+    const size_t num_points = points.size();
+    std::vector<AffineElement> point_table(num_points * 2);
+    std::copy(points.begin(), points.end(), point_table.begin());
+    scalar_multiplication::generate_pippenger_point_table<Curve>(point_table.data(), point_table.data(), num_points);
+
+    header.magic = NATIVE_CRS_MAGIC;
+    header.num_points = num_points;
+    header.point_size = sizeof(AffineElement);
+    header.g2_size = get_g2_size<Curve>();
+    const std::string path = get_native_crs_path(dir);
+    if (!write_file_atomically(
+            path, &header, sizeof(header), point_table.data(), point_table.size() * sizeof(AffineElement))) {
+        throw_or_abort(format("could not write native crs ", path));
+    }
+}
+} // namespace
+
+std::string get_native_crs_path(std::string const& dir)
+{
+    return format(dir, "/monomial/pippenger_points.dat");
+}
+
+template <typename Curve> size_t get_native_crs_size(std::string const& dir)
+{
+    NativeCrsHeader header;
+    return map_native_crs<Curve>(dir, 0, header) ? header.num_points : 0;
+}
+
+void write_native_crs(std::string const& dir,
+                      std::span<const curve::BN254::AffineElement> points,
+                      curve::BN254::G2AffineElement const& g2_x)
+{
+    NativeCrsHeader header{};
+    memcpy(header.g2_x.data(), (void const*)&g2_x, sizeof(g2_x));
+    write_native_crs_file<curve::BN254>(dir, points, header);
+}
+
+void write_native_crs(std::string const& dir, std::span<const curve::Grumpkin::AffineElement> points)
+{
+    NativeCrsHeader header{};
+    write_native_crs_file<curve::Grumpkin>(dir, points, header);
+}
+
+template <typename Curve> void convert_transcript_to_native_crs(std::string const& dir, size_t num_points)
+{
+    if (num_points == 0) {
+        num_points = srs::IO<Curve>::get_num_g1_points(dir);
+    }
+    std::vector<typename Curve::AffineElement> points(num_points);
+    srs::IO<Curve>::read_transcript_g1(points.data(), num_points, dir);
+    if constexpr (HasG2<Curve>) {
+        typename Curve::G2AffineElement g2_x;
+        srs::IO<Curve>::read_transcript_g2(g2_x, dir);
+        write_native_crs(dir, points, g2_x);
+    } else {
+        write_native_crs(dir, points);
+    }
+}
+
 FileVerifierCrs<curve::BN254>::FileVerifierCrs(std::string const& path, const size_t)
     : precomputed_g2_lines((bb::pairing::miller_lines*)(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
 {
     using Curve = curve::BN254;
-    auto point_buf = scalar_multiplication::point_table_alloc<Curve::AffineElement>(1);
-    srs::IO<Curve>::read_transcript_g1(point_buf.get(), 1, path);
-    srs::IO<curve::BN254>::read_transcript_g2(g2_x, path);
+    NativeCrsHeader header;
+    if (auto native_points = map_native_crs<Curve>(path, 1, header)) {
+        first_g1 = native_points[0];
+        memcpy((void*)&g2_x, header.g2_x.data(), sizeof(g2_x));
+    } else {
+        auto point_buf = scalar_multiplication::point_table_alloc<Curve::AffineElement>(1);
+        srs::IO<Curve>::read_transcript_g1(point_buf.get(), 1, path);
+        srs::IO<curve::BN254>::read_transcript_g2(g2_x, path);
+        first_g1 = point_buf[0];
+    }
     bb::pairing::precompute_miller_lines(bb::g2::one, precomputed_g2_lines[0]);
     bb::pairing::precompute_miller_lines(g2_x, precomputed_g2_lines[1]);
-    first_g1 = point_buf[0];
 }
 
 FileVerifierCrs<curve::BN254>::~FileVerifierCrs()
@@ -30,9 +198,13 @@ FileVerifierCrs<curve::Grumpkin>::FileVerifierCrs(std::string const& path, const
     : num_points(num_points)
 {
     using Curve = curve::Grumpkin;
-    monomials_ = scalar_multiplication::point_table_alloc<Curve::AffineElement>(num_points);
-    srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-    scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    NativeCrsHeader header;
+    monomials_ = map_native_crs<Curve>(path, num_points, header);
+    if (!monomials_) {
+        monomials_ = scalar_multiplication::point_table_alloc<Curve::AffineElement>(num_points);
+        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    }
     first_g1 = monomials_[0];
 };
 
@@ -46,6 +218,75 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
     return num_points;
 }
 
+template <typename Curve>
+FileProverCrs<Curve>::FileProverCrs(const size_t num_points, std::string const& path)
+    : num_points(num_points)
+    , path_(path)
+{
+    NativeCrsHeader header;
+    monomials_ = map_native_crs<Curve>(path, num_points, header);
+    if (monomials_) {
+        return;
+    }
+    monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+
+    srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+}
+
+template <typename Curve>
+std::string FileProverCrs<Curve>::get_fixed_base_table_path(std::string const& dir,
+                                                            size_t num_points,
+                                                            size_t num_tables)
+{
+    return format(dir, "/monomial/fixed_base_", num_tables, "x", num_points, ".dat");
+}
+
+template <typename Curve>
+scalar_multiplication::fixed_base_point_table<Curve> FileProverCrs<Curve>::get_fixed_base_point_table(
+    size_t num_tables)
+{
+    using AffineElement = typename Curve::AffineElement;
+    const std::string table_path = get_fixed_base_table_path(path_, num_points, num_tables);
+    const size_t table_size = num_points * 2 * sizeof(AffineElement);
+
+    scalar_multiplication::fixed_base_point_table<Curve> result;
+    result.num_points = num_points;
+    result.num_tables = num_tables;
+    result.bits_per_bucket = scalar_multiplication::get_fixed_base_bucket_width(num_points, num_tables);
+
+    size_t file_size = 0;
+    auto mapping = map_file_read_only(table_path, file_size);
+    if (mapping && file_size == sizeof(FixedBaseTableHeader) + result.size_in_bytes()) {
+        FixedBaseTableHeader header;
+        memcpy(&header, mapping.get(), sizeof(header));
+        auto* points = reinterpret_cast<AffineElement*>(static_cast<char*>(mapping.get()) + sizeof(header));
+        // The first table is the regular pippenger table, a mismatch means the transcript has changed under us.
+        const bool valid = header.magic == FIXED_BASE_TABLE_MAGIC && header.num_points == num_points &&
+                           header.num_tables == num_tables && header.bits_per_bucket == result.bits_per_bucket &&
+                           header.point_size == sizeof(AffineElement) &&
+                           memcmp(points, monomials_.get(), table_size) == 0;
+        if (valid) {
+            // Alias the mapping so that it stays alive as long as the table does
+            result.points = std::shared_ptr<AffineElement[]>(mapping, points);
+            return result;
+        }
+        info("ignoring stale fixed-base table ", table_path);
+    }
+
+    result = scalar_multiplication::compute_fixed_base_point_table<Curve>(monomials_.get(), num_points, num_tables);
+
+    FixedBaseTableHeader header{ FIXED_BASE_TABLE_MAGIC,
+                                 num_points,
+                                 num_tables,
+                                 result.bits_per_bucket,
+                                 sizeof(AffineElement) };
+    if (!write_file_atomically(table_path, &header, sizeof(header), result.points.get(), result.size_in_bytes())) {
+        info("could not write fixed-base table ", table_path);
+    }
+    return result;
+}
+
 template <typename Curve>
 FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
     : path_(std::move(path))
@@ -72,6 +313,10 @@ std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> FileCrsFactory<Curve>::g
     return verifier_crs_;
 }
 
+template size_t get_native_crs_size<curve::BN254>(std::string const& dir);
+template size_t get_native_crs_size<curve::Grumpkin>(std::string const& dir);
+template void convert_transcript_to_native_crs<curve::BN254>(std::string const& dir, size_t num_points);
+template void convert_transcript_to_native_crs<curve::Grumpkin>(std::string const& dir, size_t num_points);
 template class FileProverCrs<curve::BN254>;
 template class FileProverCrs<curve::Grumpkin>;
 template class FileCrsFactory<curve::BN254>;
@@ -6,10 +6,36 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "crs_factory.hpp"
 #include <cstddef>
+#include <span>
 #include <utility>
 
 namespace bb::srs::factories {
 
+/**
+ * A native CRS file (`monomial/pippenger_points.dat` next to the transcripts) holds the SRS exactly as FileProverCrs
+ * keeps it in memory: the pippenger point table (every point followed by its endomorphism) in montgomery form and
+ * native endianness. For BN254 it also holds [x]_2. FileCrsFactory memory maps it read-only instead of parsing the
+ * transcripts, so startup costs nothing and concurrent provers share the pages through the page cache.
+ */
+std::string get_native_crs_path(std::string const& dir);
+
+/**
+ * @return The number of points in the native CRS file in `dir`, 0 if there is none or it is unusable on this machine
+ */
+template <typename Curve> size_t get_native_crs_size(std::string const& dir);
+
+void write_native_crs(std::string const& dir,
+                      std::span<const curve::BN254::AffineElement> points,
+                      curve::BN254::G2AffineElement const& g2_x);
+void write_native_crs(std::string const& dir, std::span<const curve::Grumpkin::AffineElement> points);
+
+/**
+ * @brief Converts the transcript files in `dir` into a native CRS file in the same directory.
+ *
+ * @param num_points The number of points to convert, 0 for all of them
+ */
+template <typename Curve> void convert_transcript_to_native_crs(std::string const& dir, size_t num_points = 0);
+
 /**
  * Create reference strings given a path to a directory of transcript files.
  */
@@ -31,21 +57,26 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
 
 template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
   public:
-    FileProverCrs(const size_t num_points, std::string const& path)
-        : num_points(num_points)
-    {
-        monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
-
-        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
-    };
+    /**
+     * @brief Maps the native CRS file in `path` if it is large enough, otherwise reads the transcript files.
+     */
+    FileProverCrs(const size_t num_points, std::string const& path);
 
     typename Curve::AffineElement* get_monomial_points() { return monomials_.get(); }
 
     [[nodiscard]] size_t get_monomial_size() const { return num_points; }
 
+    /**
+     * @brief Memory maps the fixed-base tables from `monomial/fixed_base_<num_tables>x<num_points>.dat` next to the
+     * transcript files. If the file doesn't exist (or is stale) the tables are computed and written for next time.
+     */
+    scalar_multiplication::fixed_base_point_table<Curve> get_fixed_base_point_table(size_t num_tables) override;
+
+    static std::string get_fixed_base_table_path(std::string const& dir, size_t num_points, size_t num_tables);
+
   private:
     size_t num_points;
+    std::string path_;
     std::shared_ptr<typename Curve::AffineElement[]> monomials_;
 };
 
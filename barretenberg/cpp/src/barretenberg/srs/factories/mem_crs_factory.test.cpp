@@ -4,6 +4,7 @@
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
 #include "file_crs_factory.hpp"
+#include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
 
@@ -45,6 +46,35 @@ TEST(reference_string, mem_bn254_file_consistency)
               0);
 }
 
+TEST(reference_string, native_bn254_file_consistency)
+{
+    std::vector<g1::affine_element> points(1024);
+    ::srs::IO<BN254>::read_transcript_g1(points.data(), 1024, "../srs_db/ignition");
+    g2::affine_element g2_point;
+    ::srs::IO<BN254>::read_transcript_g2(g2_point, "../srs_db/ignition");
+
+    // Write a native crs without any transcripts next to it, so that both crs must come from the mapped file.
+    const auto native_dir = std::filesystem::temp_directory_path() / "bb_native_crs_test";
+    std::filesystem::create_directories(native_dir / "monomial");
+    write_native_crs(native_dir, points, g2_point);
+    EXPECT_EQ(get_native_crs_size<BN254>(native_dir), 1024);
+    EXPECT_EQ(get_native_crs_size<Grumpkin>(native_dir), 0);
+
+    MemBn254CrsFactory mem_crs(points, g2_point);
+    auto native_crs = FileCrsFactory<BN254>(native_dir, 512);
+    auto native_prover_crs = native_crs.get_prover_crs(512);
+    auto mem_prover_crs = mem_crs.get_prover_crs(512);
+
+    EXPECT_EQ(memcmp(mem_prover_crs->get_monomial_points(),
+                     native_prover_crs->get_monomial_points(),
+                     sizeof(g1::affine_element) * 512 * 2),
+              0);
+    EXPECT_EQ(mem_crs.get_verifier_crs()->get_g2x(), native_crs.get_verifier_crs()->get_g2x());
+    EXPECT_EQ(points[0], native_crs.get_verifier_crs()->get_first_g1());
+
+    std::filesystem::remove_all(native_dir);
+}
+
 TEST(reference_string, DISABLED_mem_grumpkin_file_consistency)
 {
     // Load 1024 from file.
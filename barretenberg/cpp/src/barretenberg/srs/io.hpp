@@ -279,6 +279,20 @@ template <typename Curve> class IO {
         byteswap<>(elements, buffer_size);
     }
 
+    /**
+     * @brief The total number of G1 points in the transcript files in `dir`
+     */
+    static size_t get_num_g1_points(std::string const& dir)
+    {
+        size_t num_points = 0;
+        for (size_t num = 0; is_file_exist(get_transcript_path(dir, num)); ++num) {
+            Manifest manifest;
+            read_manifest(get_transcript_path(dir, num), manifest);
+            num_points += manifest.num_g1_points;
+        }
+        return num_points;
+    }
+
     static void read_transcript_g1(AffineElement* monomials, size_t degree, std::string const& dir)
     {
         size_t num = 0;
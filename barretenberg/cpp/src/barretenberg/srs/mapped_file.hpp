@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::srs {
+
+namespace detail {
+inline std::shared_ptr<void> map_file([[maybe_unused]] std::string const& path,
+                                      size_t& size,
+                                      [[maybe_unused]] bool writable_private)
+{
+    size = 0;
+#ifndef __wasm__
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+    const auto file_size = static_cast<size_t>(info.st_size);
+    const int protection = writable_private ? PROT_READ | PROT_WRITE : PROT_READ;
+    const int flags = writable_private ? MAP_PRIVATE : MAP_SHARED;
+    void* data = mmap(nullptr, file_size, protection, flags, fd, 0);
+    // The mapping holds its own reference to the file
+    close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    size = file_size;
+    return { data, [file_size](void* ptr) { munmap(ptr, file_size); } };
+#else
+    return nullptr;
+#endif
+}
+} // namespace detail
+
+/**
+ * @brief Maps the file at `path` read-only into memory. The mapping is released when the last copy of the returned
+ * pointer goes away. Pages are loaded lazily by the kernel and shared between processes mapping the same file.
+ *
+ * @return The mapping, or nullptr if the file doesn't exist, is empty or can't be mapped (always the case in wasm).
+ */
+inline std::shared_ptr<void> map_file_read_only(std::string const& path, size_t& size)
+{
+    return detail::map_file(path, size, /*writable_private=*/false);
+}
+
+/**
+ * @brief Like map_file_read_only, but the mapping is writable. Writes are copy-on-write: they are private to the
+ * mapping and never reach the file.
+ */
+inline std::shared_ptr<void> map_file_private(std::string const& path, size_t& size)
+{
+    return detail::map_file(path, size, /*writable_private=*/true);
+}
+
+} // namespace bb::srs
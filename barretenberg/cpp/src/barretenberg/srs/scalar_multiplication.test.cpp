@@ -12,6 +12,7 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
@@ -63,7 +64,6 @@ TYPED_TEST(ScalarMultiplicationTests, ReduceBucketsSimple)
     using Curve = TypeParam;
     using Element = typename Curve::Element;
     using AffineElement = typename Curve::AffineElement;
-    using Fq = typename Curve::BaseField;
 
     constexpr size_t num_points = 128;
     if constexpr (srs::HasG2<Curve>) {
@@ -227,13 +227,13 @@ TYPED_TEST(ScalarMultiplicationTests, ReduceBucketsSimple)
 
     std::array<AffineElement, num_points> point_pairs;
     std::array<AffineElement, num_points> output_buckets;
-    std::array<Fq, num_points> scratch_space;
+    auto scratch_space = std::make_unique<scalar_multiplication::batch_affine_scratch<Curve>>();
     std::array<uint32_t, num_points> bucket_counts;
     std::array<uint32_t, num_points> bit_offsets = { 0 };
 
     scalar_multiplication::affine_product_runtime_state<Curve> product_state{
         &monomials[0],          &point_pairs[0],   &output_buckets[0],
-        &scratch_space[0],      &bucket_counts[0], &bit_offsets[0],
+        scratch_space.get(),    &bucket_counts[0], &bit_offsets[0],
         &point_schedule[0],     num_points,        2,
         &bucket_empty_status[0]
     };
@@ -253,7 +253,6 @@ TYPED_TEST(ScalarMultiplicationTests, ReduceBuckets)
     using Element = typename Curve::Element;
     using AffineElement = typename Curve::AffineElement;
     using Fr = typename Curve::ScalarField;
-    using Fq = typename Curve::BaseField;
 
     constexpr size_t num_initial_points = 1 << 12;
     constexpr size_t num_points = num_initial_points * 2;
@@ -268,9 +267,7 @@ TYPED_TEST(ScalarMultiplicationTests, ReduceBuckets)
     memset((void*)expected_buckets, 0x00, (num_points * 2) * sizeof(Element));
     memset((void*)bucket_empty_status, 0x00, (num_points * 2) * sizeof(bool));
 
-    Fq* scratch_field = (Fq*)(aligned_alloc(64, sizeof(Fq) * (num_points)));
-
-    memset((void*)scratch_field, 0x00, num_points * sizeof(Fq));
+    auto scratch_space = std::make_unique<scalar_multiplication::batch_affine_scratch<Curve>>();
 
     TestFixture::read_transcript(monomials, num_initial_points, TestFixture::SRS_PATH);
 
@@ -315,7 +312,7 @@ TYPED_TEST(ScalarMultiplicationTests, ReduceBuckets)
     scalar_multiplication::affine_product_runtime_state<Curve> product_state{ monomials,
                                                                               point_pairs,
                                                                               scratch_points,
-                                                                              scratch_field,
+                                                                              scratch_space.get(),
                                                                               bucket_counts,
                                                                               &bit_offsets[0],
                                                                               &state.point_schedule[num_points],
@@ -363,7 +360,6 @@ TYPED_TEST(ScalarMultiplicationTests, ReduceBuckets)
     aligned_free(point_schedule_copy);
     aligned_free(point_pairs);
     aligned_free(scratch_points);
-    aligned_free(scratch_field);
     aligned_free(scalars);
     aligned_free(monomials);
     aligned_free(bucket_counts);
@@ -375,7 +371,6 @@ TYPED_TEST(ScalarMultiplicationTests, DISABLED_ReduceBucketsBasic)
     using Curve = TypeParam;
     using AffineElement = typename Curve::AffineElement;
     using Fr = typename Curve::ScalarField;
-    using Fq = typename Curve::BaseField;
 
     constexpr size_t num_initial_points = 1 << 20;
     constexpr size_t num_points = num_initial_points * 2;
@@ -384,11 +379,10 @@ TYPED_TEST(ScalarMultiplicationTests, DISABLED_ReduceBucketsBasic)
     AffineElement* point_pairs = (AffineElement*)(aligned_alloc(64, sizeof(AffineElement) * (num_points)));
     bool* bucket_empty_status = (bool*)(aligned_alloc(64, sizeof(bool) * (num_points)));
 
-    Fq* scratch_field = (Fq*)(aligned_alloc(64, sizeof(Fq) * (num_points)));
+    auto scratch_space = std::make_unique<scalar_multiplication::batch_affine_scratch<Curve>>();
 
     memset((void*)scratch_points, 0x00, num_points * sizeof(AffineElement));
     memset((void*)point_pairs, 0x00, num_points * sizeof(AffineElement));
-    memset((void*)scratch_field, 0x00, num_points * sizeof(Fq));
     memset((void*)bucket_empty_status, 0x00, num_points * sizeof(bool));
 
     TestFixture::read_transcript(monomials, num_initial_points, TestFixture::SRS_PATH);
@@ -428,7 +422,7 @@ TYPED_TEST(ScalarMultiplicationTests, DISABLED_ReduceBucketsBasic)
     scalar_multiplication::affine_product_runtime_state<Curve> product_state{ monomials,
                                                                               point_pairs,
                                                                               scratch_points,
-                                                                              scratch_field,
+                                                                              scratch_space.get(),
                                                                               bucket_counts,
                                                                               &bit_offsets[0],
                                                                               state.point_schedule,
@@ -446,7 +440,6 @@ TYPED_TEST(ScalarMultiplicationTests, DISABLED_ReduceBucketsBasic)
     aligned_free(bucket_empty_status);
     aligned_free(point_pairs);
     aligned_free(scratch_points);
-    aligned_free(scratch_field);
     aligned_free(scalars);
     aligned_free(monomials);
     aligned_free(bucket_counts);
@@ -461,7 +454,7 @@ TYPED_TEST(ScalarMultiplicationTests, AddAffinePoints)
 
     constexpr size_t num_points = 20;
     AffineElement* points = (AffineElement*)(aligned_alloc(64, sizeof(AffineElement) * (num_points)));
-    Fq* scratch_space = (Fq*)(aligned_alloc(64, sizeof(Fq) * (num_points * 2)));
+    auto scratch_space = std::make_unique<scalar_multiplication::batch_affine_scratch<Curve>>();
     Fq* lambda = (Fq*)(aligned_alloc(64, sizeof(Fq) * (num_points * 2)));
 
     Element* points_copy = (Element*)(aligned_alloc(64, sizeof(Element) * (num_points)));
@@ -478,7 +471,7 @@ TYPED_TEST(ScalarMultiplicationTests, AddAffinePoints)
         points_copy[count + 1] = points_copy[count + 1].normalize();
     }
 
-    scalar_multiplication::add_affine_points<Curve>(points, num_points, scratch_space);
+    scalar_multiplication::add_affine_points<Curve>(points, num_points, scratch_space.get());
     for (size_t i = num_points - 1; i > num_points - 1 - (num_points / 2); --i) {
         EXPECT_EQ((points[i].x == points_copy[i].x), true);
         EXPECT_EQ((points[i].y == points_copy[i].y), true);
@@ -486,7 +479,6 @@ TYPED_TEST(ScalarMultiplicationTests, AddAffinePoints)
     aligned_free(lambda);
     aligned_free(points);
     aligned_free(points_copy);
-    aligned_free(scratch_space);
 }
 
 TYPED_TEST(ScalarMultiplicationTests, ConstructAdditionChains)
@@ -959,6 +951,119 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, FixedBasePippenger)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 4096;
+
+    std::vector<Fr> scalars(num_points);
+    // std::vector honours the alignment of AffineElement, the pippenger point allocator only aligns to 32 bytes
+    std::vector<AffineElement> point_table(num_points * 2);
+    AffineElement* points = point_table.data();
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points[i] = AffineElement(Element::random_element());
+    }
+    // Exercise the sparse wnaf paths too
+    scalars[1] = Fr::zero();
+    scalars[2] = Fr(engine.get_random_uint32());
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    for (size_t num_tables = 1; num_tables <= 4; ++num_tables) {
+        auto table = scalar_multiplication::compute_fixed_base_point_table<Curve>(points, num_points, num_tables);
+        scalar_multiplication::fixed_base_runtime_state<Curve> state(num_points, num_tables);
+
+        // Full size, a size that isn't a power of two, and one small enough to use the fallback
+        for (const size_t num_msm_points : { num_points, num_points - 123, size_t(100) }) {
+            Element expected;
+            expected.self_set_infinity();
+            for (size_t i = 0; i < num_msm_points; ++i) {
+                expected += points[i * 2] * scalars[i];
+            }
+            Element result = scalar_multiplication::fixed_base_pippenger_unsafe<Curve>(
+                &scalars[0], table, num_msm_points, state);
+            EXPECT_EQ(result.normalize(), expected.normalize());
+        }
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, FixedBaseTableShifts)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 16;
+    constexpr size_t num_tables = 3;
+
+    // std::vector honours the alignment of AffineElement, the pippenger point allocator only aligns to 32 bytes
+    std::vector<AffineElement> point_table(num_points * 2);
+    AffineElement* points = point_table.data();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+    auto table = scalar_multiplication::compute_fixed_base_point_table<Curve>(points, num_points, num_tables);
+
+    const Fr shift = Fr(uint256_t(1) << table.get_table_shift());
+    Fr multiplier = Fr::one();
+    for (size_t k = 0; k < num_tables; ++k) {
+        for (size_t i = 0; i < num_points * 2; ++i) {
+            EXPECT_EQ(table.points.get()[k * num_points * 2 + i], AffineElement(Element(points[i]) * multiplier));
+        }
+        multiplier *= shift;
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatch)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 2048;
+
+    // std::vector honours the alignment of AffineElement, the pippenger point allocator only aligns to 32 bytes
+    std::vector<AffineElement> point_table(num_points * 2);
+    AffineElement* points = point_table.data();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    // Full size, sizes that are split into several slices, one small enough to skip pippenger and an empty one
+    const std::vector<size_t> sizes = { num_points, num_points - 1, 1000, num_points, 5, 0 };
+    std::vector<std::vector<Fr>> scalars;
+    std::vector<std::span<const Fr>> scalar_spans;
+    for (const size_t size : sizes) {
+        scalars.emplace_back(size);
+        for (auto& scalar : scalars.back()) {
+            scalar = Fr::random_element();
+        }
+        scalar_spans.emplace_back(scalars.back());
+    }
+
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> next_state(num_points);
+    std::vector<Element> results(sizes.size());
+    scalar_multiplication::pippenger_batch_unsafe<Curve>(scalar_spans, points, state, next_state, results);
+
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t j = 0; j < sizes[i]; ++j) {
+            expected += points[j * 2] * scalars[i][j];
+        }
+        EXPECT_EQ(results[i].normalize(), expected.normalize());
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
 {
     using Curve = TypeParam;
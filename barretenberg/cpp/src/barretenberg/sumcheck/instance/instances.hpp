@@ -4,6 +4,43 @@
 
 namespace bb {
 
+/**
+ * @brief Evaluate the Lagrange basis of the folding domain {0, ..., NUM - 1} at a point
+ * @details L_i(X) = Π_{j ≠ i} (X - j) / (i - j); the denominators are inverted together.
+ */
+template <typename FF, size_t NUM> std::array<FF, NUM> compute_lagrange_basis_at(const FF& point)
+{
+    std::array<FF, NUM> numerators;
+    std::array<FF, NUM> denominators;
+    for (size_t i = 0; i < NUM; i++) {
+        numerators[i] = FF(1);
+        denominators[i] = FF(1);
+        for (size_t j = 0; j < NUM; j++) {
+            if (j != i) {
+                numerators[i] *= point - FF(j);
+                denominators[i] *= FF(i) - FF(j);
+            }
+        }
+    }
+    FF::batch_invert(denominators);
+    for (size_t i = 0; i < NUM; i++) {
+        numerators[i] *= denominators[i];
+    }
+    return numerators;
+}
+
+/**
+ * @brief Evaluate the vanishing polynomial Z(X) = Π_{i < NUM} (X - i) of the folding domain at a point
+ */
+template <typename FF, size_t NUM> FF compute_vanishing_polynomial_at(const FF& point)
+{
+    FF result = FF(1);
+    for (size_t i = 0; i < NUM; i++) {
+        result *= point - FF(i);
+    }
+    return result;
+}
+
 template <typename Flavor_, size_t NUM_ = 2> struct ProverInstances_ {
   public:
     static_assert(NUM_ > 1, "Must have at least two prover instances");
@@ -54,10 +91,16 @@ template <typename Flavor_, size_t NUM_ = 2> struct ProverInstances_ {
      * @param row_idx A fixed row position in several execution traces
      * @return The univariates whose extensions will be used to construct the combiner.
      */
-    auto row_to_univariates(size_t row_idx) const
+    auto row_to_univariates(size_t row_idx) const { return row_to_univariates(get_polynomials_views(), row_idx); }
+
+    /**
+     * @brief As above, reading from views of the instances' polynomials obtained once with get_polynomials_views, so
+     * that loops over rows do not rebuild them on every row.
+     */
+    template <typename PolynomialsViews>
+    static auto row_to_univariates(const PolynomialsViews& insts_prover_polynomials_views, size_t row_idx)
     {
-        auto insts_prover_polynomials_views = get_polynomials_views();
-        std::array<Univariate<FF, NUM>, insts_prover_polynomials_views[0].size()> results;
+        std::array<Univariate<FF, NUM>, Flavor::NUM_ALL_ENTITIES> results;
         // Set the size corresponding to the number of rows in the execution trace
         size_t instance_idx = 0;
         // Iterate over the prover polynomials' views corresponding to each instance
@@ -71,8 +114,7 @@ template <typename Flavor_, size_t NUM_ = 2> struct ProverInstances_ {
         return results;
     }
 
-  private:
-    // Returns a vector containing pointer views to the prover polynomials corresponding to each instance.
+    // Returns an array containing pointer views to the prover polynomials corresponding to each instance.
     auto get_polynomials_views() const
     {
         // As a practical measure, get the first instance's view to deduce the array type
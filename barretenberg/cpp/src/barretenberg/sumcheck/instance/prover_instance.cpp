@@ -11,8 +11,10 @@ namespace bb {
  *
  * @tparam Flavor
  * @param circuit
+ * @param is_structured Whether the blocks take up their fixed sizes, in which case the size does not depend on the
+ * number of gates
  */
-template <class Flavor> size_t ProverInstance_<Flavor>::compute_dyadic_size(Circuit& circuit)
+template <class Flavor> size_t ProverInstance_<Flavor>::compute_dyadic_size(Circuit& circuit, bool is_structured)
 {
     // minimum circuit size due to lookup argument
     const size_t min_size_due_to_lookups = circuit.get_tables_size() + circuit.get_lookups_size();
@@ -21,6 +23,9 @@ template <class Flavor> size_t ProverInstance_<Flavor>::compute_dyadic_size(Circ
     size_t min_size_of_execution_trace = circuit.public_inputs.size() + circuit.num_gates;
     if constexpr (IsGoblinFlavor<Flavor>) {
         min_size_of_execution_trace += circuit.num_ecc_op_gates;
+        if (is_structured) {
+            min_size_of_execution_trace = circuit.blocks.get_structured_size();
+        }
     }
 
     // The number of gates is the maxmimum required by the lookup argument or everything else, plus an optional zero row
@@ -74,6 +79,27 @@ void ProverInstance_<Flavor>::construct_table_polynomials(Circuit& circuit, size
     proving_key->table_4 = table_polynomials[3].share();
 }
 
+/**
+ * @brief Add the rows that are active outside of the execution trace blocks to the proving key's active row ranges
+ * @details These are the first and last rows (lagrange_first, lagrange_last), the lookup tables and sorted lists placed
+ * at the end of the trace (see construct_lookup_table_polynomials) and, for Goblin, the databus columns, which start at
+ * row 0. Everywhere else the wires and selectors vanish, the copy permutation is the identity and the grand products
+ * evolve by a constant factor, so that all relations vanish identically.
+ *
+ * @tparam Flavor
+ * @param circuit
+ */
+template <class Flavor> void ProverInstance_<Flavor>::add_non_trace_active_row_ranges(Circuit& circuit)
+{
+    auto& active_row_ranges = proving_key->active_row_ranges;
+    active_row_ranges.emplace_back(0, 1);
+    const size_t lookup_offset = dyadic_circuit_size - circuit.get_tables_size() - circuit.get_lookups_size();
+    active_row_ranges.emplace_back(std::min(lookup_offset, dyadic_circuit_size - 1), dyadic_circuit_size);
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        active_row_ranges.emplace_back(0, circuit.public_calldata.size());
+    }
+}
+
 template <class Flavor> void ProverInstance_<Flavor>::initialize_prover_polynomials()
 {
     for (auto [prover_poly, key_poly] : zip_view(prover_polynomials.get_unshifted(), proving_key->get_all())) {
@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/flavor/ultra.hpp"
@@ -43,22 +44,52 @@ template <class Flavor> class ProverInstance_ {
     // The folding parameters (\vec{β}, e) which are set for accumulators (i.e. relaxed instances).
     std::vector<FF> gate_challenges;
     FF target_sum;
-
-    ProverInstance_(Circuit& circuit)
+    // The values of the full Honk relation at each row of an accumulator, computed by the folding prover that produced
+    // it for the perturbator of the next fold. Empty if not computed, e.g. once the polynomials have been modified.
+    std::vector<FF> full_honk_evaluations;
+
+    /**
+     * @brief Complete the circuit before its trace is constructed. For Goblin flavors this appends to the op queue,
+     * unlike the rest of the construction of an instance which only reads the circuit.
+     */
+    static void finalize_circuit(Circuit& circuit)
     {
-        BB_OP_COUNT_TIME_NAME("ProverInstance(Circuit&)");
         circuit.add_gates_to_ensure_all_polys_are_non_zero();
         circuit.finalize_circuit();
         if constexpr (IsGoblinFlavor<Flavor>) {
             circuit.op_queue->append_nonzero_ops();
         }
+    }
 
-        dyadic_circuit_size = compute_dyadic_size(circuit);
+    /**
+     * @param trace_structure If not NONE, the blocks of the execution trace are placed at fixed offsets (only supported
+     * by Goblin flavors)
+     * @param circuit_is_finalized Whether finalize_circuit has already been called on the circuit
+     */
+    ProverInstance_(Circuit& circuit,
+                    TraceStructure trace_structure = TraceStructure::NONE,
+                    bool circuit_is_finalized = false)
+    {
+        BB_OP_COUNT_TIME_NAME("ProverInstance(Circuit&)");
+        if (!circuit_is_finalized) {
+            finalize_circuit(circuit);
+        }
+
+        const bool is_structured = trace_structure != TraceStructure::NONE;
+        if (is_structured) {
+            if constexpr (IsGoblinFlavor<Flavor>) {
+                circuit.blocks.set_fixed_block_sizes(trace_structure);
+            } else {
+                throw_or_abort("structured execution traces are only supported by Goblin flavors");
+            }
+        }
+
+        dyadic_circuit_size = compute_dyadic_size(circuit, is_structured);
 
         proving_key = std::make_shared<ProvingKey>(dyadic_circuit_size, circuit.public_inputs.size());
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
-        Trace::populate(circuit, proving_key);
+        Trace::populate(circuit, proving_key, is_structured);
 
         // If Goblin, construct the databus polynomials
         if constexpr (IsGoblinFlavor<Flavor>) {
@@ -73,15 +104,15 @@ template <class Flavor> class ProverInstance_ {
 
         construct_table_polynomials(circuit, dyadic_circuit_size);
 
+        // Note: this must precede the construction of the sorted list polynomials, which changes the lookups size
+        add_non_trace_active_row_ranges(circuit);
+
         sorted_polynomials = construct_sorted_list_polynomials<Flavor>(circuit, dyadic_circuit_size);
 
         std::span<FF> public_wires_source = proving_key->w_r;
 
         // Determine public input offsets in the circuit relative to the 0th index for Ultra flavors
-        proving_key->pub_inputs_offset = Flavor::has_zero_row ? 1 : 0;
-        if constexpr (IsGoblinFlavor<Flavor>) {
-            proving_key->pub_inputs_offset += proving_key->num_ecc_op_gates;
-        }
+        proving_key->pub_inputs_offset = circuit.blocks.pub_inputs.trace_offset;
         // Construct the public inputs array
         for (size_t i = 0; i < proving_key->num_public_inputs; ++i) {
             size_t idx = i + proving_key->pub_inputs_offset;
@@ -111,13 +142,15 @@ template <class Flavor> class ProverInstance_ {
     static constexpr size_t NUM_WIRES = Circuit::NUM_WIRES;
     size_t dyadic_circuit_size = 0; // final power-of-2 circuit size
 
-    size_t compute_dyadic_size(Circuit&);
+    size_t compute_dyadic_size(Circuit&, bool is_structured);
 
     void construct_databus_polynomials(Circuit&)
         requires IsGoblinFlavor<Flavor>;
 
     void construct_table_polynomials(Circuit&, size_t);
 
+    void add_non_trace_active_row_ranges(Circuit&);
+
     void add_plookup_memory_records_to_wire_4(FF);
 };
 
@@ -1,9 +1,12 @@
 #pragma once
+#include "barretenberg/ecc/fields/field_batch.hpp"
 #include "barretenberg/proof_system/library/grand_product_delta.hpp"
 #include "barretenberg/sumcheck/instance/prover_instance.hpp"
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "sumcheck_round.hpp"
+#include <limits>
+#include <span>
 
 namespace bb {
 
@@ -23,6 +26,8 @@ template <typename Flavor> class SumcheckProver {
 
     std::shared_ptr<Transcript> transcript;
     SumcheckProverRound<Flavor> round;
+    // The number of leading rounds computed directly from the full polynomials, see compute_num_streaming_rounds
+    const size_t num_streaming_rounds;
 
     /**
     *
@@ -57,13 +62,38 @@ template <typename Flavor> class SumcheckProver {
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
 
-    // prover instantiates sumcheck with circuit size and a prover transcript
-    SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
+    // prover instantiates sumcheck with circuit size and a prover transcript. The memory limit (in bytes) bounds the
+    // storage allocated for partially_evaluated_polynomials, see compute_num_streaming_rounds.
+    SumcheckProver(size_t multivariate_n,
+                   const std::shared_ptr<Transcript>& transcript,
+                   size_t memory_limit = std::numeric_limits<size_t>::max())
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
         , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , num_streaming_rounds(compute_num_streaming_rounds(multivariate_n, memory_limit))
+        , partially_evaluated_polynomials(multivariate_n >> (num_streaming_rounds - 1)){};
+
+    /**
+     * @brief The number of rounds k to compute from the full polynomials before switching to in-place folding.
+     *
+     * @details Folding after round 0 allocates a copy of every polynomial of half the circuit size, i.e. the peak
+     * memory is 1.5x that of the prover polynomials. Instead, round r < k can be computed directly from the full
+     * polynomials: the edge values of round r are the sums \sum_t eq(u_0, ..., u_{r-1}; t) P[j * 2^r + t] over the
+     * 2^r entries folded into them. Each such round costs about as many multiplications as a partial evaluation, but
+     * the partially evaluated polynomials are then only materialized after round k - 1 with n / 2^k entries each. We
+     * pick the smallest k for which they fit in memory_limit. Without a limit k = 1, which is the regular prover.
+     */
+    static size_t compute_num_streaming_rounds(size_t multivariate_n, size_t memory_limit)
+    {
+        const size_t multivariate_d = numeric::get_msb(multivariate_n);
+        size_t num_rounds = 1;
+        while (num_rounds < multivariate_d &&
+               Flavor::NUM_ALL_ENTITIES * (multivariate_n >> num_rounds) * sizeof(FF) > memory_limit) {
+            num_rounds++;
+        }
+        return num_rounds;
+    }
 
     /**
      * @brief Compute univariate restriction place in transcript, generate challenge, partially evaluate,... repeat
@@ -71,20 +101,31 @@ template <typename Flavor> class SumcheckProver {
      */
     SumcheckOutput<Flavor> prove(std::shared_ptr<Instance> instance)
     {
-        return prove(
-            instance->prover_polynomials, instance->relation_parameters, instance->alphas, instance->gate_challenges);
+        // The relations vanish outside of the active rows of a circuit's trace. This does not hold for an accumulator,
+        // whose grand product polynomials are combinations of those of several circuits.
+        std::span<const std::pair<size_t, size_t>> active_row_ranges;
+        if (!instance->is_accumulator) {
+            active_row_ranges = instance->proving_key->active_row_ranges;
+        }
+        return prove(instance->prover_polynomials,
+                     instance->relation_parameters,
+                     instance->alphas,
+                     instance->gate_challenges,
+                     active_row_ranges);
     };
 
     /**
      * @brief Compute univariate restriction place in transcript, generate challenge, partially evaluate,... repeat
      * until final round, then compute multivariate evaluations and place in transcript.
      *
-     * @details
+     * @details If active_row_ranges is non-empty, the first round skips the edges that only read rows outside of these
+     * ranges (see SumcheckProverRound::compute_active_edge_ranges). The relations must vanish identically there.
      */
     SumcheckOutput<Flavor> prove(ProverPolynomials& full_polynomials,
                                  const bb::RelationParameters<FF>& relation_parameters,
                                  const RelationSeparator alpha,
-                                 const std::vector<FF>& gate_challenges)
+                                 const std::vector<FF>& gate_challenges,
+                                 std::span<const std::pair<size_t, size_t>> active_row_ranges = {})
     {
 
         bb::PowPolynomial<FF> pow_univariate(gate_challenges);
@@ -94,17 +135,43 @@ template <typename Flavor> class SumcheckProver {
         multivariate_challenge.reserve(multivariate_d);
 
         // First round
-        // This populates partially_evaluated_polynomials.
-        auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
+        auto round_univariate =
+            round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha, active_row_ranges);
         transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
         FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
         multivariate_challenge.emplace_back(round_challenge);
-        partially_evaluate(full_polynomials, multivariate_n, round_challenge);
         pow_univariate.partially_evaluate(round_challenge);
-        round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                  // release memory?        // All but final round
+        round.round_size = round.round_size >> 1;
+
+        // Memory bounded rounds, computed from the full polynomials without folding them (see
+        // compute_num_streaming_rounds). eq_weights[t] = eq(u_0, ..., u_{r-1}; t) for t < 2^r in round r.
+        std::vector<FF> eq_weights = { FF(1) - round_challenge, round_challenge };
+        for (size_t round_idx = 1; round_idx < num_streaming_rounds; round_idx++) {
+            round_univariate = round.compute_univariate_streaming(
+                full_polynomials, eq_weights, relation_parameters, pow_univariate, alpha);
+            transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
+            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+            multivariate_challenge.emplace_back(round_challenge);
+            const size_t num_weights = eq_weights.size();
+            eq_weights.resize(2 * num_weights);
+            for (size_t t = 0; t < num_weights; t++) {
+                eq_weights[num_weights + t] = eq_weights[t] * round_challenge;
+                eq_weights[t] -= eq_weights[num_weights + t];
+            }
+            pow_univariate.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1;
+        }
+
+        // This populates partially_evaluated_polynomials.
+        if (num_streaming_rounds == 1) {
+            partially_evaluate(full_polynomials, multivariate_n, multivariate_challenge[0]);
+        } else {
+            partially_evaluate_streaming(full_polynomials, eq_weights);
+        }
+
+        // All but final round
         // We operate on partially_evaluated_polynomials in place.
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        for (size_t round_idx = num_streaming_rounds; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
             round_univariate =
                 round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
@@ -147,9 +214,25 @@ template <typename Flavor> class SumcheckProver {
         auto pep_view = partially_evaluated_polynomials.get_all();
         auto poly_view = polynomials.get_all();
         // after the first round, operate in place on partially_evaluated_polynomials
+        parallel_for(poly_view.size(),
+                     [&](size_t j) { fold_polynomial(pep_view[j], poly_view[j], round_size, round_challenge); });
+    };
+    /**
+     * @brief Populate partially_evaluated_polynomials with the full polynomials evaluated at the first log2(|weights|)
+     * challenges, i.e. entry i of each polynomial is \sum_t weights[t] P[i * |weights| + t].
+     */
+    void partially_evaluate_streaming(auto& polynomials, std::span<const FF> weights)
+    {
+        auto pep_view = partially_evaluated_polynomials.get_all();
+        auto poly_view = polynomials.get_all();
+        const size_t stride = weights.size();
         parallel_for(poly_view.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j][i >> 1] = poly_view[j][i] + round_challenge * (poly_view[j][i + 1] - poly_view[j][i]);
+            for (size_t i = 0; i < (multivariate_n / stride); i++) {
+                FF result(0);
+                for (size_t t = 0; t < stride; t++) {
+                    result += weights[t] * poly_view[j][i * stride + t];
+                }
+                pep_view[j][i] = result;
             }
         });
     };
@@ -162,12 +245,35 @@ template <typename Flavor> class SumcheckProver {
     {
         auto pep_view = partially_evaluated_polynomials.get_all();
         // after the first round, operate in place on partially_evaluated_polynomials
-        parallel_for(polynomials.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j][i >> 1] = polynomials[j][i] + round_challenge * (polynomials[j][i + 1] - polynomials[j][i]);
-            }
-        });
+        parallel_for(polynomials.size(),
+                     [&](size_t j) { fold_polynomial(pep_view[j], polynomials[j], round_size, round_challenge); });
     };
+
+    /**
+     * @brief Set result[i] = poly[2i] + challenge * (poly[2i + 1] - poly[2i]) for 2i < round_size. The result may be
+     * the polynomial itself.
+     * @details The even entries and the differences are gathered into contiguous blocks first so that the
+     * multiplications can be batched, see field_batch.hpp.
+     */
+    static void fold_polynomial(auto& result, const auto& poly, size_t round_size, const FF& challenge)
+    {
+        constexpr size_t BLOCK_SIZE = 64;
+        std::array<FF, BLOCK_SIZE> evens;
+        std::array<FF, BLOCK_SIZE> differences;
+        const size_t result_size = round_size >> 1;
+        for (size_t start = 0; start < result_size; start += BLOCK_SIZE) {
+            const size_t block_size = std::min(BLOCK_SIZE, result_size - start);
+            for (size_t i = 0; i < block_size; ++i) {
+                evens[i] = poly[2 * (start + i)];
+                differences[i] = poly[2 * (start + i) + 1] - evens[i];
+            }
+            // Writing result[start, start + block_size) never clobbers entries of poly not yet read
+            fma_n<FF>(std::span<FF>(&result[start], block_size),
+                      std::span<const FF>(differences.data(), block_size),
+                      challenge,
+                      std::span<const FF>(evens.data(), block_size));
+        }
+    }
 };
 
 template <typename Flavor> class SumcheckVerifier {
@@ -166,6 +166,88 @@ TEST_F(SumcheckTests, Prover)
     }
 }
 
+/**
+ * @brief Check that bounding the memory of the prover, which computes the first rounds from the full polynomials
+ * instead of folding them, produces the same proof as the regular prover.
+ */
+TEST_F(SumcheckTests, MemoryBoundedProver)
+{
+    const size_t multivariate_d(5);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    std::array<Polynomial<FF>, NUM_POLYNOMIALS> random_polynomials;
+    for (auto& poly : random_polynomials) {
+        poly = random_poly(multivariate_n);
+    }
+    auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+    RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(multivariate_d);
+    for (auto& gate_challenge : gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+
+    auto prove = [&](size_t memory_limit) {
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript, memory_limit);
+        auto output = sumcheck.prove(full_polynomials, {}, alpha, gate_challenges);
+        return std::make_tuple(sumcheck.num_streaming_rounds, output, transcript->proof_data);
+    };
+
+    const auto [expected_num_rounds, expected_output, expected_proof] = prove(std::numeric_limits<size_t>::max());
+    EXPECT_EQ(expected_num_rounds, size_t(1));
+    for (size_t num_rounds = 2; num_rounds <= multivariate_d; num_rounds++) {
+        const size_t memory_limit = NUM_POLYNOMIALS * (multivariate_n >> num_rounds) * sizeof(FF);
+        const auto [num_streaming_rounds, output, proof] = prove(memory_limit);
+        EXPECT_EQ(num_streaming_rounds, num_rounds);
+        EXPECT_EQ(output.challenge, expected_output.challenge);
+        for (auto [eval, expected_eval] :
+             zip_view(output.claimed_evaluations.get_all(), expected_output.claimed_evaluations.get_all())) {
+            EXPECT_EQ(eval, expected_eval);
+        }
+        EXPECT_EQ(proof, expected_proof);
+    }
+}
+
+/**
+ * @brief Check that splitting the work of the prover by relation produces the same proof as splitting it by edges, for
+ * both the rounds computed from the full polynomials and the folded ones.
+ */
+TEST_F(SumcheckTests, ScheduleByRelation)
+{
+    const size_t multivariate_d(5);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    std::array<Polynomial<FF>, NUM_POLYNOMIALS> random_polynomials;
+    for (auto& poly : random_polynomials) {
+        poly = random_poly(multivariate_n);
+    }
+    auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+    RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(multivariate_d);
+    for (auto& gate_challenge : gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+
+    auto prove = [&](bool schedule_by_relation) {
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        const size_t memory_limit = NUM_POLYNOMIALS * (multivariate_n >> 2) * sizeof(FF);
+        auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript, memory_limit);
+        sumcheck.round.schedule_by_relation = schedule_by_relation;
+        sumcheck.prove(full_polynomials, {}, alpha, gate_challenges);
+        return transcript->proof_data;
+    };
+
+    EXPECT_EQ(prove(true), prove(false));
+}
+
 // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
 TEST_F(SumcheckTests, ProverAndVerifierSimple)
 {
@@ -1,10 +1,16 @@
 #pragma once
+#include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/pow.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 #include "barretenberg/relations/utils.hpp"
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace bb {
 
@@ -54,6 +60,9 @@ template <typename Flavor> class SumcheckProverRound {
     using Utils = bb::RelationUtils<Flavor>;
     using Relations = typename Flavor::Relations;
     using SumcheckTupleOfTuplesOfUnivariates = typename Flavor::SumcheckTupleOfTuplesOfUnivariates;
+    // The per-thread accumulators, which defer the reductions of the relations that support it
+    using SumcheckTupleOfTuplesOfUnreducedUnivariates =
+        decltype(create_sumcheck_tuple_of_tuples_of_unreduced_univariates<Relations>());
     using RelationSeparator = typename Flavor::RelationSeparator;
 
   public:
@@ -62,6 +71,10 @@ template <typename Flavor> class SumcheckProverRound {
 
     size_t round_size; // a power of 2
 
+    // Whether compute_univariate splits its work over pairs of a relation and a chunk of edges rather than over chunks
+    // of edges only, see compute_univariate_internal
+    bool schedule_by_relation = false;
+
     static constexpr size_t NUM_RELATIONS = Flavor::NUM_RELATIONS;
     static constexpr size_t MAX_PARTIAL_RELATION_LENGTH = Flavor::MAX_PARTIAL_RELATION_LENGTH;
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = Flavor::BATCHED_RELATION_PARTIAL_LENGTH;
@@ -77,7 +90,8 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
     /**
-     * @brief Extend each edge in the edge group at to max-relation-length-many values.
+     * @brief Extend each edge in the edge group to as many values as the relations reading it use (at most
+     * max-relation-length-many, see get_extension_lengths).
      *
      * @details Should only be called externally with relation_idx equal to 0.
      * In practice, multivariates is one of ProverPolynomials or FoldedPolynomials.
@@ -88,25 +102,321 @@ template <typename Flavor> class SumcheckProverRound {
                       const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
                       size_t edge_idx)
     {
-        for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
-            bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
-            extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+        for (auto [extended_edge, multivariate, length] :
+             zip_view(extended_edges.get_all(), multivariates.get_all(), get_extension_lengths())) {
+            if (length != 0) {
+                extend_column(extended_edge, multivariate, edge_idx, length);
+            }
         }
     }
 
+    /**
+     * @brief Extend the edges of a round whose polynomials have not been partially evaluated yet, i.e. reading the
+     * full polynomials. The value at index i of the current round is \sum_t eq_weights[t] P[i * |eq_weights| + t],
+     * where eq_weights are the evaluations of eq(u_0, ..., u_{r-1}; t) at the previous challenges.
+     */
+    template <typename ProverPolynomials>
+    void extend_edges_streaming(ExtendedEdges& extended_edges,
+                                const ProverPolynomials& multivariates,
+                                std::span<const FF> eq_weights,
+                                size_t edge_idx)
+    {
+        for (auto [extended_edge, multivariate, length] :
+             zip_view(extended_edges.get_all(), multivariates.get_all(), get_extension_lengths())) {
+            if (length != 0) {
+                extend_column_streaming(extended_edge, multivariate, eq_weights, edge_idx, length);
+            }
+        }
+    }
+
+    /**
+     * @brief The number of values each extended edge is computed at, in the order of ExtendedEdges::get_all()
+     *
+     * @details A relation reads the edges through the views of its subrelation accumulators, so it only reads the
+     * first RELATION_LENGTH values of each of them. An edge is therefore extended to the largest RELATION_LENGTH among
+     * the relations that read it, and not at all if no relation does. The relations do not declare which polynomials
+     * they read, so this is found once per flavor: each relation is evaluated at random edges and is taken to read a
+     * polynomial if its value changes when the edge of that polynomial is changed.
+     */
+    static const std::array<size_t, Flavor::NUM_ALL_ENTITIES>& get_extension_lengths()
+    {
+        static const std::array<size_t, Flavor::NUM_ALL_ENTITIES> extension_lengths = [] {
+            std::array<size_t, Flavor::NUM_ALL_ENTITIES> lengths{};
+            const auto& relation_inputs = get_relation_inputs();
+            constexpr_for<0, NUM_RELATIONS, 1>([&]<size_t relation_idx>() {
+                for (const size_t column_idx : relation_inputs[relation_idx]) {
+                    lengths[column_idx] =
+                        std::max(lengths[column_idx], std::tuple_element_t<relation_idx, Relations>::RELATION_LENGTH);
+                }
+            });
+            return lengths;
+        }();
+        return extension_lengths;
+    }
+
+    /**
+     * @brief For each relation, the indices in ExtendedEdges::get_all() of the polynomials it reads (see
+     * get_extension_lengths)
+     */
+    static const std::array<std::vector<size_t>, NUM_RELATIONS>& get_relation_inputs()
+    {
+        static const std::array<std::vector<size_t>, NUM_RELATIONS> relation_inputs = compute_relation_inputs();
+        return relation_inputs;
+    }
+
+    /**
+     * @brief Convert ranges of active rows into the ranges of edges that can contribute to the round univariate.
+     *
+     * @details The edge at (even) index i reads rows i and i + 1 and, through the shifted polynomials, row i + 2. It
+     * can only be skipped if none of these rows is active. An empty set of row ranges means that every row is active.
+     *
+     * @param active_row_ranges Ranges [start, end) of rows, in any order
+     * @return Sorted, disjoint ranges [start, end) of edge indices, with even endpoints
+     */
+    std::vector<std::pair<size_t, size_t>> compute_active_edge_ranges(
+        std::span<const std::pair<size_t, size_t>> active_row_ranges) const
+    {
+        if (active_row_ranges.empty()) {
+            return { { 0, round_size } };
+        }
+        std::vector<std::pair<size_t, size_t>> edge_ranges;
+        for (const auto& [row_start, row_end] : active_row_ranges) {
+            const size_t start = (row_start < 2 ? 0 : row_start - 2) & ~size_t(1);
+            const size_t end = std::min((row_end + 1) & ~size_t(1), round_size);
+            if (start < end) {
+                edge_ranges.emplace_back(start, end);
+            }
+        }
+        std::sort(edge_ranges.begin(), edge_ranges.end());
+
+        // Merge overlapping and adjacent ranges
+        std::vector<std::pair<size_t, size_t>> merged_ranges;
+        for (const auto& range : edge_ranges) {
+            if (!merged_ranges.empty() && range.first <= merged_ranges.back().second) {
+                merged_ranges.back().second = std::max(merged_ranges.back().second, range.second);
+            } else {
+                merged_ranges.emplace_back(range);
+            }
+        }
+        return merged_ranges;
+    }
+
     /**
      * @brief Return the evaluations of the univariate restriction (S_l(X_l) in the thesis) at num_multivariates-many
      * values. Most likely this will end up being S_l(0), ... , S_l(t-1) where t is around 12. At the end, reset all
      * univariate accumulators to be zero.
+     *
+     * @param active_row_ranges Ranges of rows outside of which every relation vanishes identically (see
+     * ProvingKey_::active_row_ranges). Edges that only read inactive rows are skipped. Empty means all rows are active.
      */
     template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
     bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> compute_univariate(
         ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
         const bb::RelationParameters<FF>& relation_parameters,
         const bb::PowPolynomial<FF>& pow_polynomial,
+        const RelationSeparator alpha,
+        std::span<const std::pair<size_t, size_t>> active_row_ranges = {})
+    {
+        BB_OP_COUNT_TIME();
+        return compute_univariate_internal(
+            polynomials,
+            [](ExtendedEdgeUnivariate& extended_edge, const auto& multivariate, size_t edge_idx, size_t length) {
+                extend_column(extended_edge, multivariate, edge_idx, length);
+            },
+            compute_active_edge_ranges(active_row_ranges),
+            relation_parameters,
+            pow_polynomial,
+            alpha);
+    }
+
+    /**
+     * @brief Same as compute_univariate, for a round whose polynomials are computed on the fly from the full
+     * polynomials (see extend_edges_streaming and SumcheckProver::compute_num_streaming_rounds).
+     */
+    template <typename ProverPolynomials>
+    bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> compute_univariate_streaming(
+        const ProverPolynomials& full_polynomials,
+        std::span<const FF> eq_weights,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::PowPolynomial<FF>& pow_polynomial,
         const RelationSeparator alpha)
     {
         BB_OP_COUNT_TIME();
+        return compute_univariate_internal(
+            full_polynomials,
+            [&](ExtendedEdgeUnivariate& extended_edge, const auto& multivariate, size_t edge_idx, size_t length) {
+                extend_column_streaming(extended_edge, multivariate, eq_weights, edge_idx, length);
+            },
+            compute_active_edge_ranges({}),
+            relation_parameters,
+            pow_polynomial,
+            alpha);
+    }
+
+  private:
+    using ExtendedEdgeUnivariate = bb::Univariate<FF, MAX_PARTIAL_RELATION_LENGTH>;
+
+    /**
+     * @brief Set the first length values of the extension of the edge (lo, hi), i.e. lo + i * (hi - lo) for i < length
+     */
+    static void extend_edge(ExtendedEdgeUnivariate& extended_edge, const FF& lo, const FF& hi, size_t length)
+    {
+        const FF delta = hi - lo;
+        extended_edge.value_at(0) = lo;
+        extended_edge.value_at(1) = hi;
+        for (size_t i = 2; i < length; ++i) {
+            extended_edge.value_at(i) = extended_edge.value_at(i - 1);
+            extended_edge.value_at(i) += delta;
+        }
+    }
+
+    /**
+     * @brief Set the first length values of the extension of the edge of multivariate at edge_idx
+     */
+    static void extend_column(ExtendedEdgeUnivariate& extended_edge,
+                              const auto& multivariate,
+                              size_t edge_idx,
+                              size_t length)
+    {
+        extend_edge(extended_edge, multivariate[edge_idx], multivariate[edge_idx + 1], length);
+    }
+
+    /**
+     * @brief Set the first length values of the extension of the edge at edge_idx of a round computed from the full
+     * polynomial multivariate (see extend_edges_streaming)
+     */
+    static void extend_column_streaming(ExtendedEdgeUnivariate& extended_edge,
+                                        const auto& multivariate,
+                                        std::span<const FF> eq_weights,
+                                        size_t edge_idx,
+                                        size_t length)
+    {
+        const size_t stride = eq_weights.size();
+        const size_t offset = edge_idx * stride;
+        FF lo(0);
+        FF hi(0);
+        for (size_t t = 0; t < stride; t++) {
+            lo += eq_weights[t] * multivariate[offset + t];
+            hi += eq_weights[t] * multivariate[offset + stride + t];
+        }
+        extend_edge(extended_edge, lo, hi, length);
+    }
+
+    static std::array<std::vector<size_t>, NUM_RELATIONS> compute_relation_inputs()
+    {
+        ExtendedEdges edges;
+        for (auto& edge : edges.get_all()) {
+            edge = ExtendedEdgeUnivariate::get_random();
+        }
+        const auto relation_parameters = bb::RelationParameters<FF>::get_random();
+        const auto evaluate_relations = [&]() {
+            SumcheckTupleOfTuplesOfUnivariates evaluations;
+            Utils::zero_univariates(evaluations);
+            constexpr_for<0, NUM_RELATIONS, 1>([&]<size_t relation_idx>() {
+                std::tuple_element_t<relation_idx, Relations>::accumulate(
+                    std::get<relation_idx>(evaluations), edges, relation_parameters, FF(1));
+            });
+            return evaluations;
+        };
+        const auto reference_evaluations = evaluate_relations();
+
+        std::array<std::vector<size_t>, NUM_RELATIONS> relation_inputs;
+        size_t column_idx = 0;
+        for (auto& edge : edges.get_all()) {
+            const ExtendedEdgeUnivariate original_edge = edge;
+            edge = ExtendedEdgeUnivariate::get_random();
+            const auto evaluations = evaluate_relations();
+            constexpr_for<0, NUM_RELATIONS, 1>([&]<size_t relation_idx>() {
+                if (std::get<relation_idx>(evaluations) != std::get<relation_idx>(reference_evaluations)) {
+                    relation_inputs[relation_idx].push_back(column_idx);
+                }
+            });
+            edge = original_edge;
+            column_idx++;
+        }
+        return relation_inputs;
+    }
+
+    /**
+     * @brief Call func with the index of each active edge in the chunk chunk_idx, when the active edges are numbered
+     * consecutively across the ranges and split evenly into num_chunks chunks
+     */
+    template <typename Func>
+    static void for_each_edge_in_chunk(const std::vector<std::pair<size_t, size_t>>& edge_ranges,
+                                       size_t num_active_edges,
+                                       size_t chunk_idx,
+                                       size_t num_chunks,
+                                       const Func& func)
+    {
+        const size_t start = chunk_idx * num_active_edges / num_chunks;
+        const size_t end = (chunk_idx + 1) * num_active_edges / num_chunks;
+
+        size_t range_offset = 0; // the number of active edges in the preceding ranges
+        for (const auto& [range_start, range_end] : edge_ranges) {
+            const size_t range_size = (range_end - range_start) >> 1;
+            const size_t first = std::max(start, range_offset);
+            const size_t last = std::min(end, range_offset + range_size);
+            for (size_t position = first; position < last; ++position) {
+                func(range_start + 2 * (position - range_offset));
+            }
+            range_offset += range_size;
+        }
+    }
+
+    /**
+     * @brief Accumulate the contributions of a single relation over the edges of a chunk, extending only the edges of
+     * the polynomials that the relation reads and only to its RELATION_LENGTH
+     */
+    template <size_t relation_idx, typename Multivariates, typename ColumnExtender>
+    void accumulate_relation_over_chunk(SumcheckTupleOfTuplesOfUnreducedUnivariates& univariate_accumulators,
+                                        const Multivariates& multivariates,
+                                        const ColumnExtender& extend_column_at,
+                                        const std::vector<std::pair<size_t, size_t>>& edge_ranges,
+                                        size_t num_active_edges,
+                                        size_t chunk_idx,
+                                        size_t num_chunks,
+                                        const bb::RelationParameters<FF>& relation_parameters,
+                                        const std::vector<FF>& pow_challenges)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        // The values past the extension length are read by Relation::skip only, see compute_univariate_internal
+        auto extended_edges = std::make_unique<ExtendedEdges>();
+        for (auto& edge : extended_edges->get_all()) {
+            edge = ExtendedEdgeUnivariate(FF(0));
+        }
+        auto edges = extended_edges->get_all();
+        const auto polynomials = multivariates.get_all();
+        const auto& inputs = get_relation_inputs()[relation_idx];
+
+        for_each_edge_in_chunk(edge_ranges, num_active_edges, chunk_idx, num_chunks, [&](size_t edge_idx) {
+            for (const size_t column_idx : inputs) {
+                extend_column_at(edges[column_idx], polynomials[column_idx], edge_idx, Relation::RELATION_LENGTH);
+            }
+            accumulate_relation_univariate<relation_idx>(
+                univariate_accumulators, *extended_edges, relation_parameters, pow_challenges[edge_idx >> 1]);
+        });
+    }
+
+    /**
+     * @brief Compute the round univariate over the active edges, where extend_column_at(extended_edge, multivariate,
+     * edge_idx, length) sets the first length values of the extension of the edge of multivariate at edge_idx
+     *
+     * @details The active edges are split into chunks, one per thread. By default a thread extends all edges of its
+     * chunk and accumulates every relation on them. With schedule_by_relation, the work is instead split into tasks for
+     * each pair of a chunk and a relation: a task extends only the edges its relation reads and only updates the
+     * accumulators of that relation. For wide flavors such as the AVM, whose relations each read a small part of many
+     * polynomials, the working set of a task is then a fraction of that of a whole chunk, at the cost of extending the
+     * edges read by several relations once for each.
+     */
+    template <typename Multivariates, typename ColumnExtender>
+    bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> compute_univariate_internal(
+        const Multivariates& multivariates,
+        const ColumnExtender& extend_column_at,
+        const std::vector<std::pair<size_t, size_t>>& edge_ranges,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::PowPolynomial<FF>& pow_polynomial,
+        const RelationSeparator alpha)
+    {
 
         // Compute the constant contribution of pow polynomials for each edge. This is  the product of the partial
         // evaluation result c_l (i.e. pow(u_0,...,u_{l-1})) where u_0,...,u_{l-1} are the verifier challenges from
@@ -117,44 +427,78 @@ template <typename Flavor> class SumcheckProverRound {
             pow_challenges[i] = pow_challenges[0] * pow_polynomial[i * pow_polynomial.periodicity];
         }
 
+        size_t num_active_edges = 0;
+        for (const auto& [range_start, range_end] : edge_ranges) {
+            num_active_edges += (range_end - range_start) >> 1;
+        }
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
         // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
         size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+        size_t num_threads = bb::calculate_num_threads_pow2(2 * num_active_edges, min_iterations_per_thread);
 
         // Construct univariate accumulator containers; one per thread
-        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+        std::vector<SumcheckTupleOfTuplesOfUnreducedUnivariates> thread_univariate_accumulators(num_threads);
         for (auto& accum : thread_univariate_accumulators) {
             Utils::zero_univariates(accum);
         }
 
-        // Construct extended edge containers; one per thread
-        std::vector<ExtendedEdges> extended_edges;
-        extended_edges.resize(num_threads);
-
-        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
-        parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-
-                // Compute the i-th edge's univariate contribution,
-                // scale it by pow_challenge constant contribution and add it to the accumulators for Sˡ(Xₗ)
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_challenges[edge_idx >> 1]);
+        if (schedule_by_relation) {
+            // The tasks of a chunk update disjoint parts of the chunk's accumulators
+            parallel_for(num_threads * NUM_RELATIONS, [&](size_t task_idx) {
+                const size_t chunk_idx = task_idx / NUM_RELATIONS;
+                constexpr_for<0, NUM_RELATIONS, 1>([&]<size_t relation_idx>() {
+                    if (relation_idx == task_idx % NUM_RELATIONS) {
+                        accumulate_relation_over_chunk<relation_idx>(thread_univariate_accumulators[chunk_idx],
+                                                                     multivariates,
+                                                                     extend_column_at,
+                                                                     edge_ranges,
+                                                                     num_active_edges,
+                                                                     chunk_idx,
+                                                                     num_threads,
+                                                                     relation_parameters,
+                                                                     pow_challenges);
+                    }
+                });
+            });
+        } else {
+            // Construct extended edge containers; one per thread. The values of an edge past its extension length are
+            // never written, so they are zeroed once for Relation::skip, which reads all of them.
+            std::vector<ExtendedEdges> extended_edges(num_threads);
+            for (auto& edges : extended_edges) {
+                for (auto& edge : edges.get_all()) {
+                    edge = ExtendedEdgeUnivariate(FF(0));
+                }
             }
-        });
 
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
+            // Accumulate the contribution from each sub-relation accross each active edge of the hyper-cube
+            parallel_for(num_threads, [&](size_t thread_idx) {
+                auto edges = extended_edges[thread_idx].get_all();
+                const auto polynomials = multivariates.get_all();
+                const auto& extension_lengths = get_extension_lengths();
+                for_each_edge_in_chunk(edge_ranges, num_active_edges, thread_idx, num_threads, [&](size_t edge_idx) {
+                    for (size_t column_idx = 0; column_idx < Flavor::NUM_ALL_ENTITIES; column_idx++) {
+                        if (extension_lengths[column_idx] != 0) {
+                            extend_column_at(
+                                edges[column_idx], polynomials[column_idx], edge_idx, extension_lengths[column_idx]);
+                        }
+                    }
+
+                    // Compute the i-th edge's univariate contribution,
+                    // scale it by pow_challenge constant contribution and add it to the accumulators for Sˡ(Xₗ)
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges[thread_idx],
+                                                    relation_parameters,
+                                                    pow_challenges[edge_idx >> 1]);
+                });
+            });
+        }
+
+        // Reduce the per-thread univariate accumulators and add them into a single set of accumulators
         for (auto& accumulators : thread_univariate_accumulators) {
-            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+            Utils::add_reduced_nested_tuples(univariate_accumulators, accumulators);
         }
 
         // Batch the univariate contributions from each sub-relation to obtain the round univariate
@@ -162,6 +506,7 @@ template <typename Flavor> class SumcheckProverRound {
             univariate_accumulators, alpha, pow_polynomial);
     }
 
+  public:
     /**
      * @brief Given a tuple t = (t_0, t_1, ..., t_{NUM_SUBRELATIONS-1}) and a challenge α,
      * return t_0 + αt_1 + ... + α^{NUM_SUBRELATIONS-1}t_{NUM_SUBRELATIONS-1}).
@@ -235,14 +580,13 @@ template <typename Flavor> class SumcheckProverRound {
      * appropriate scaling factors, produces S_l.
      */
     template <size_t relation_idx = 0>
-    void accumulate_relation_univariates(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
+    void accumulate_relation_univariates(SumcheckTupleOfTuplesOfUnreducedUnivariates& univariate_accumulators,
                                          const auto& extended_edges,
                                          const bb::RelationParameters<FF>& relation_parameters,
                                          const FF& scaling_factor)
     {
-        using Relation = std::tuple_element_t<relation_idx, Relations>;
-        Relation::accumulate(
-            std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        accumulate_relation_univariate<relation_idx>(
+            univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
@@ -250,6 +594,30 @@ template <typename Flavor> class SumcheckProverRound {
                 univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
         }
     }
+
+    /**
+     * @brief Add the contribution of a single relation for a given edge to its accumulators
+     */
+    template <size_t relation_idx>
+    static void accumulate_relation_univariate(SumcheckTupleOfTuplesOfUnreducedUnivariates& univariate_accumulators,
+                                               const auto& extended_edges,
+                                               const bb::RelationParameters<FF>& relation_parameters,
+                                               const FF& scaling_factor)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        // Relations that are switched off by a selector are not accumulated on edges where the selector vanishes
+        if constexpr (isSkippable<Relation, ExtendedEdges>) {
+            if (!Relation::skip(extended_edges)) {
+                Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
+                                     extended_edges,
+                                     relation_parameters,
+                                     scaling_factor);
+            }
+        } else {
+            Relation::accumulate(
+                std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        }
+    }
 };
 
 template <typename Flavor> class SumcheckVerifierRound {
@@ -1,4 +1,5 @@
 #include "sumcheck_round.hpp"
+#include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/flavor/ultra.hpp"
 #include "barretenberg/relations/utils.hpp"
 
@@ -131,3 +132,49 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+/**
+ * @brief Check that each edge is extended as far as the relations reading it require, and to the same values as a full
+ * extension
+ *
+ */
+TEST(SumcheckRound, ExtensionLengths)
+{
+    using Flavor = GoblinUltraFlavor;
+    using FF = typename Flavor::FF;
+    using ExtendedEdges = typename Flavor::ExtendedEdges;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    const size_t MAX_LENGTH = Flavor::MAX_PARTIAL_RELATION_LENGTH;
+
+    const size_t round_size = 4;
+    ProverPolynomials polynomials;
+    for (auto& polynomial : polynomials.get_all()) {
+        polynomial = Flavor::Polynomial::random(round_size);
+    }
+
+    SumcheckProverRound<Flavor> round(round_size);
+    ExtendedEdges extended_edges;
+    round.extend_edges(extended_edges, polynomials, 2);
+
+    const auto& extension_lengths = SumcheckProverRound<Flavor>::get_extension_lengths();
+    for (auto [extended_edge, polynomial, length] :
+         zip_view(extended_edges.get_all(), polynomials.get_all(), extension_lengths)) {
+        EXPECT_LE(length, MAX_LENGTH);
+        auto expected = Univariate<FF, 2>({ polynomial[2], polynomial[3] }).template extend_to<MAX_LENGTH>();
+        for (size_t i = 0; i < length; ++i) {
+            EXPECT_EQ(extended_edge.value_at(i), expected.value_at(i));
+        }
+    }
+
+    // The wires are read by the longest relations, the ecc op wires only by the ecc op queue relation
+    const auto extension_length_of = [&](const auto& member) {
+        for (auto [edge, length] : zip_view(extended_edges.get_all(), extension_lengths)) {
+            if (&edge == &member) {
+                return length;
+            }
+        }
+        return size_t(-1);
+    };
+    EXPECT_EQ(extension_length_of(extended_edges.w_l), MAX_LENGTH);
+    EXPECT_EQ(extension_length_of(extended_edges.ecc_op_wire_1), EccOpQueueRelation<FF>::RELATION_LENGTH);
+}
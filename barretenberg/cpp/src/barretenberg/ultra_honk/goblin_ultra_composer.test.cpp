@@ -173,3 +173,41 @@ TEST_F(GoblinUltraHonkComposerTests, MultipleCircuitsHonkAndMerge)
         EXPECT_EQ(result, expected);
     }
 }
+
+/**
+ * @brief Test proof construction/verification for circuits of different sizes with a structured execution trace
+ * @details With a structured trace the two circuits must have the same size and the same block offsets even though
+ * they contain a different number of gates.
+ *
+ */
+TEST_F(GoblinUltraHonkComposerTests, StructuredTrace)
+{
+    auto op_queue = std::make_shared<bb::ECCOpQueue>();
+
+    GoblinMockCircuits::perform_op_queue_interactions_for_mock_first_circuit(op_queue);
+
+    auto small_builder = GoblinUltraCircuitBuilder{ op_queue };
+    GoblinMockCircuits::construct_simple_circuit(small_builder);
+
+    auto large_builder = GoblinUltraCircuitBuilder{ op_queue };
+    GoblinMockCircuits::construct_simple_circuit(large_builder);
+    MockCircuits::construct_arithmetic_circuit(large_builder, /*target_log2_dyadic_size=*/9);
+
+    using ProverInstance = ProverInstance_<GoblinUltraFlavor>;
+    auto small_instance = std::make_shared<ProverInstance>(small_builder, TraceStructure::SMALL_TEST);
+    auto large_instance = std::make_shared<ProverInstance>(large_builder, TraceStructure::SMALL_TEST);
+
+    EXPECT_EQ(small_instance->proving_key->circuit_size, large_instance->proving_key->circuit_size);
+    EXPECT_EQ(small_instance->proving_key->pub_inputs_offset, large_instance->proving_key->pub_inputs_offset);
+    for (auto [small_block, large_block] : zip_view(small_builder.blocks.get(), large_builder.blocks.get())) {
+        EXPECT_EQ(small_block.trace_offset, large_block.trace_offset);
+    }
+
+    for (auto& instance : { small_instance, large_instance }) {
+        GoblinUltraProver prover(instance);
+        auto verification_key = std::make_shared<GoblinUltraFlavor::VerificationKey>(instance->proving_key);
+        GoblinUltraVerifier verifier(verification_key);
+        auto proof = prover.construct_proof();
+        EXPECT_TRUE(verifier.verify_proof(proof));
+    }
+}
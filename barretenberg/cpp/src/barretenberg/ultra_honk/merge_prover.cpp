@@ -57,7 +57,7 @@ template <typename Flavor> HonkProof MergeProver_<Flavor>::construct_proof()
         // Get previous transcript commitment [T_{i-1}] from op queue
         auto C_T_prev = op_queue->ultra_ops_commitments[idx];
         // Compute commitment [t_i^{shift}] directly
-        auto C_t_shift = pcs_commitment_key->commit(t_shift[idx]);
+        auto C_t_shift = pcs_commitment_key->commit_sparse(t_shift[idx]);
         // Compute updated aggregate transcript commitment as [T_i] = [T_{i-1}] + [t_i^{shift}]
         C_T_current[idx] = C_T_prev + C_t_shift;
 
@@ -32,9 +32,11 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
 {
     // Commit to the first three wire polynomials of the instance
     // We only commit to the fourth wire polynomial after adding memory recordss
-    witness_commitments.w_l = commitment_key->commit(instance->proving_key->w_l);
-    witness_commitments.w_r = commitment_key->commit(instance->proving_key->w_r);
-    witness_commitments.w_o = commitment_key->commit(instance->proving_key->w_o);
+    const auto wire_commitments = commitment_key->batch_commit(std::vector<std::span<const FF>>{
+        instance->proving_key->w_l, instance->proving_key->w_r, instance->proving_key->w_o });
+    witness_commitments.w_l = wire_commitments[0];
+    witness_commitments.w_r = wire_commitments[1];
+    witness_commitments.w_o = wire_commitments[2];
 
     auto wire_comms = witness_commitments.get_wires();
     auto wire_labels = commitment_labels.get_wires();
@@ -43,11 +45,11 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
-        // Commit to Goblin ECC op wires
-        witness_commitments.ecc_op_wire_1 = commitment_key->commit(instance->proving_key->ecc_op_wire_1);
-        witness_commitments.ecc_op_wire_2 = commitment_key->commit(instance->proving_key->ecc_op_wire_2);
-        witness_commitments.ecc_op_wire_3 = commitment_key->commit(instance->proving_key->ecc_op_wire_3);
-        witness_commitments.ecc_op_wire_4 = commitment_key->commit(instance->proving_key->ecc_op_wire_4);
+        // Commit to Goblin ECC op wires. These and the DataBus columns are mostly zero outside of their own blocks.
+        witness_commitments.ecc_op_wire_1 = commitment_key->commit_sparse(instance->proving_key->ecc_op_wire_1);
+        witness_commitments.ecc_op_wire_2 = commitment_key->commit_sparse(instance->proving_key->ecc_op_wire_2);
+        witness_commitments.ecc_op_wire_3 = commitment_key->commit_sparse(instance->proving_key->ecc_op_wire_3);
+        witness_commitments.ecc_op_wire_4 = commitment_key->commit_sparse(instance->proving_key->ecc_op_wire_4);
 
         auto op_wire_comms = witness_commitments.get_ecc_op_wires();
         auto labels = commitment_labels.get_ecc_op_wires();
@@ -55,8 +57,9 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
             transcript->send_to_verifier(domain_separator + labels[idx], op_wire_comms[idx]);
         }
         // Commit to DataBus columns
-        witness_commitments.calldata = commitment_key->commit(instance->proving_key->calldata);
-        witness_commitments.calldata_read_counts = commitment_key->commit(instance->proving_key->calldata_read_counts);
+        witness_commitments.calldata = commitment_key->commit_sparse(instance->proving_key->calldata);
+        witness_commitments.calldata_read_counts =
+            commitment_key->commit_sparse(instance->proving_key->calldata_read_counts);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata, witness_commitments.calldata);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata_read_counts,
                                      witness_commitments.calldata_read_counts);
@@ -75,8 +78,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
 
     // Commit to the sorted witness-table accumulator and the finalized (i.e. with memory records) fourth wire
     // polynomial
-    witness_commitments.sorted_accum = commitment_key->commit(instance->proving_key->sorted_accum);
-    witness_commitments.w_4 = commitment_key->commit(instance->proving_key->w_4);
+    const auto commitments = commitment_key->batch_commit(
+        std::vector<std::span<const FF>>{ instance->proving_key->sorted_accum, instance->proving_key->w_4 });
+    witness_commitments.sorted_accum = commitments[0];
+    witness_commitments.w_4 = commitments[1];
 
     transcript->send_to_verifier(domain_separator + commitment_labels.sorted_accum, witness_commitments.sorted_accum);
     transcript->send_to_verifier(domain_separator + commitment_labels.w_4, witness_commitments.w_4);
@@ -110,8 +115,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_grand_product_c
     instance->compute_grand_product_polynomials(instance->relation_parameters.beta,
                                                 instance->relation_parameters.gamma);
 
-    witness_commitments.z_perm = commitment_key->commit(instance->proving_key->z_perm);
-    witness_commitments.z_lookup = commitment_key->commit(instance->proving_key->z_lookup);
+    const auto commitments = commitment_key->batch_commit(
+        std::vector<std::span<const FF>>{ instance->proving_key->z_perm, instance->proving_key->z_lookup });
+    witness_commitments.z_perm = commitments[0];
+    witness_commitments.z_lookup = commitments[1];
 
     transcript->send_to_verifier(domain_separator + commitment_labels.z_perm, witness_commitments.z_perm);
     transcript->send_to_verifier(domain_separator + commitment_labels.z_lookup, witness_commitments.z_lookup);
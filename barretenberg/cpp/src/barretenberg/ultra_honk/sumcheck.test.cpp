@@ -197,3 +197,72 @@ TEST_F(SumcheckTestsRealCircuit, Ultra)
 
     ASSERT_TRUE(verified);
 }
+
+/**
+ * @brief Check that the first round univariate is unchanged when the edges outside of the active row ranges of the
+ * proving key are skipped, for a circuit padded to a power of two with a large empty region
+ *
+ */
+TEST_F(SumcheckTestsRealCircuit, SkipInactiveRows)
+{
+    using RelationSeparator = typename Flavor::RelationSeparator;
+
+    auto builder = UltraCircuitBuilder();
+    uint32_t a_idx = builder.add_public_variable(FF(1));
+    uint32_t b_idx = builder.add_variable(FF(2));
+    uint32_t c_idx = builder.add_variable(FF(3));
+    for (size_t i = 0; i < 300; i++) {
+        builder.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+    }
+
+    // Add a sort gate and an elliptic curve addition gate so that the gated relations are active on a few rows
+    builder.create_sort_constraint(
+        { builder.add_variable(FF(0)), builder.add_variable(FF(1)), builder.add_variable(FF(2)), c_idx });
+    grumpkin::g1::affine_element p1 = grumpkin::g1::affine_element::random_element();
+    grumpkin::g1::affine_element p2 = grumpkin::g1::affine_element::random_element();
+    grumpkin::g1::affine_element p3(grumpkin::g1::element(p1) + grumpkin::g1::element(p2));
+    builder.create_ecc_add_gate({ builder.add_variable(p1.x),
+                                  builder.add_variable(p1.y),
+                                  builder.add_variable(p2.x),
+                                  builder.add_variable(p2.y),
+                                  builder.add_variable(p3.x),
+                                  builder.add_variable(p3.y),
+                                  1 });
+
+    auto instance = std::make_shared<ProverInstance_<Flavor>>(builder);
+    instance->initialize_prover_polynomials();
+    instance->compute_sorted_accumulator_polynomials(FF::random_element());
+    instance->compute_grand_product_polynomials(FF::random_element(), FF::random_element());
+
+    const size_t circuit_size = instance->proving_key->circuit_size;
+    RelationSeparator alphas;
+    for (auto& alpha : alphas) {
+        alpha = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(numeric::get_msb(circuit_size));
+    for (auto& gate_challenge : gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+    PowPolynomial<FF> pow_polynomial(gate_challenges);
+    pow_polynomial.compute_values();
+
+    SumcheckProverRound<Flavor> round(circuit_size);
+    const auto& active_row_ranges = instance->proving_key->active_row_ranges;
+    size_t num_active_edges = 0;
+    for (const auto& [start, end] : round.compute_active_edge_ranges(active_row_ranges)) {
+        num_active_edges += (end - start) / 2;
+    }
+    EXPECT_LT(num_active_edges, circuit_size / 2);
+
+    auto univariate = round.compute_univariate(
+        instance->prover_polynomials, instance->relation_parameters, pow_polynomial, alphas);
+    auto skipping_univariate = round.compute_univariate(
+        instance->prover_polynomials, instance->relation_parameters, pow_polynomial, alphas, active_row_ranges);
+    EXPECT_EQ(univariate, skipping_univariate);
+
+    // The same univariate is obtained when the work is split by relation
+    round.schedule_by_relation = true;
+    auto skipping_univariate_by_relation = round.compute_univariate(
+        instance->prover_polynomials, instance->relation_parameters, pow_polynomial, alphas, active_row_ranges);
+    EXPECT_EQ(univariate, skipping_univariate_by_relation);
+}
@@ -41,7 +41,7 @@ template <IsUltraFlavor Flavor> void UltraProver_<Flavor>::execute_relation_chec
 {
     using Sumcheck = SumcheckProver<Flavor>;
     auto circuit_size = instance->proving_key->circuit_size;
-    auto sumcheck = Sumcheck(circuit_size, transcript);
+    auto sumcheck = Sumcheck(circuit_size, transcript, sumcheck_memory_limit);
     RelationSeparator alphas;
     for (size_t idx = 0; idx < alphas.size(); idx++) {
         alphas[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
@@ -8,6 +8,7 @@
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/oink_prover.hpp"
+#include <limits>
 
 namespace bb {
 
@@ -42,6 +43,10 @@ template <IsUltraFlavor Flavor_> class UltraProver_ {
 
     OinkProver<Flavor> oink_prover;
 
+    // Bound (in bytes) on the memory sumcheck allocates for the partially evaluated polynomials, see
+    // SumcheckProver::compute_num_streaming_rounds
+    size_t sumcheck_memory_limit = std::numeric_limits<size_t>::max();
+
     explicit UltraProver_(const std::shared_ptr<Instance>&,
                           const std::shared_ptr<Transcript>& transcript = std::make_shared<Transcript>());
 